@@ -12,6 +12,144 @@
 #include "assert.h"
 #include <stddef.h>
 
+#if CC_COPY_MODE != CC_COPY_BYTES
+#include <string.h>
+#endif
+
+#if (CC_COPY_MODE == CC_COPY_WORDS) && defined(__GNUC__)
+typedef uint32_t __attribute__((__may_alias__)) CC_word_t;
+#endif
+
+#if CC_RX_SIMD
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+#endif
+
+#if (CC_SYNC_MODE == CC_SYNC_BARRIER) && !defined(CC_COMPILER_BARRIER)
+#define CC_COMPILER_BARRIER() __asm__ volatile("" ::: "memory")
+#endif
+
+/**
+ * @brief Reads a ring index owned by the calling side.
+ *
+ * @param[in] Index Pointer to the ring index.
+ * @return uint16_t Index value.
+ */
+static inline uint16_t CC_Index_Load(const CC_INDEX_t *Index)
+{
+#if CC_SYNC_MODE == CC_SYNC_C11
+    return atomic_load_explicit(Index, memory_order_relaxed);
+#else
+    return *Index;
+#endif
+}
+
+/**
+ * @brief Reads a ring index published by the other side.
+ *
+ * Ring slots are accessed only after this load, so a frame published by the
+ * producer is complete when the consumer reads it, and a slot released by the
+ * consumer is no longer read when the producer overwrites it.
+ *
+ * @param[in] Index Pointer to the ring index.
+ * @return uint16_t Index value.
+ */
+static inline uint16_t CC_Index_Acquire(const CC_INDEX_t *Index)
+{
+#if CC_SYNC_MODE == CC_SYNC_C11
+    return atomic_load_explicit(Index, memory_order_acquire);
+#elif CC_SYNC_MODE == CC_SYNC_BARRIER
+    uint16_t Value = *Index;
+    CC_COMPILER_BARRIER();
+    return Value;
+#else
+    return *Index;
+#endif
+}
+
+/**
+ * @brief Publishes a ring index to the other side.
+ *
+ * All ring slot accesses issued before this store complete before the new
+ * index becomes visible.
+ *
+ * @param[out] Index Pointer to the ring index.
+ * @param[in] Value New index value.
+ */
+static inline void CC_Index_Release(CC_INDEX_t *Index, uint16_t Value)
+{
+#if CC_SYNC_MODE == CC_SYNC_C11
+    atomic_store_explicit(Index, Value, memory_order_release);
+#elif CC_SYNC_MODE == CC_SYNC_BARRIER
+    CC_COMPILER_BARRIER();
+    *Index = Value;
+#else
+    *Index = Value;
+#endif
+}
+
+#if CC_RX_MAILBOX
+/**
+ * @brief Marks the start of a write protected by a sequence number.
+ *
+ * The new (odd) sequence number becomes visible before any of the following writes.
+ *
+ * @param[out] Seq Pointer to the sequence number.
+ * @param[in] Value New sequence number.
+ */
+static inline void CC_Seq_WriteBegin(CC_INDEX_t *Seq, uint16_t Value)
+{
+#if CC_SYNC_MODE == CC_SYNC_C11
+    atomic_store_explicit(Seq, Value, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+#elif CC_SYNC_MODE == CC_SYNC_BARRIER
+    *Seq = Value;
+    CC_COMPILER_BARRIER();
+#else
+    *Seq = Value;
+#endif
+}
+
+/**
+ * @brief Checks whether data read under a sequence number may be torn.
+ *
+ * All reads issued before this call complete before the sequence number is read again.
+ *
+ * @param[in] Seq Pointer to the sequence number.
+ * @param[in] Start Sequence number read with CC_Index_Acquire before the data.
+ * @return uint8_t Non-zero if a write was in progress or happened since Start.
+ */
+static inline uint8_t CC_Seq_ReadRetry(const CC_INDEX_t *Seq, uint16_t Start)
+{
+#if CC_SYNC_MODE == CC_SYNC_C11
+    atomic_thread_fence(memory_order_acquire);
+#elif CC_SYNC_MODE == CC_SYNC_BARRIER
+    CC_COMPILER_BARRIER();
+#endif
+    return (uint8_t)((0u != (Start & 1u)) || (CC_Index_Load(Seq) != Start));
+}
+
+/**
+ * @brief Orders a preceding index store before a following index load.
+ *
+ * Used where each side stores its own index and then loads the other side's, so at
+ * least one of them sees the other's store.
+ */
+static inline void CC_Fence_Full(void)
+{
+#if CC_SYNC_MODE == CC_SYNC_C11
+    atomic_thread_fence(memory_order_seq_cst);
+#elif CC_SYNC_MODE == CC_SYNC_BARRIER
+    CC_COMPILER_BARRIER();
+#endif
+}
+#endif
+
 #if CC_TICK_FROM_FUNC
 
 CC_TIME_t (*CC_get_tick)(void) = NULL;
@@ -40,301 +178,3620 @@ void CC_tick_variable_register(CC_TIME_t *Variable)
 
 #endif
 
-/**
- * @brief Initializes the CAN RX instance with message table and callbacks.
- *
- * Sets the RX message table, its size, and function pointers for
- * parsing unregistered messages and handling timeouts.
- *
- * @param Instance Pointer to the RX instance to initialize.
- * @param RxTable Pointer to the RX message registration table.
- * @param TableSize Number of entries in the RxTable.
- * @param Parser_unreg_msg Callback for parsing unregistered messages.
- * @param TimeoutCallback Callback for timeout handling.
- */
-void CC_RX_init(CC_RX_instance_t *Instance, CC_RX_table_t *RxTable, uint16_t TableSize,
-                void (*Parser_unreg_msg)(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg),
-                void (*TimeoutCallback)(CC_RX_instance_t *Instance, uint16_t Slot))
+#if CC_PROFILE || CC_LATENCY
+
+uint32_t (*CC_get_cycles)(void) = NULL;
+
+void CC_cycle_function_register(uint32_t (*Function)(void))
 {
-    Instance->RxTable = RxTable;
-    Instance->TableSize = TableSize;
-    Instance->Parser_unreg_msg = Parser_unreg_msg;
-    Instance->TimeoutCallback = TimeoutCallback;
+    assert(Function != NULL);
+
+    CC_get_cycles = Function;
+}
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+
+#define CC_DEMCR (*(volatile uint32_t *)0xE000EDFCu)
+#define CC_DWT_CTRL (*(volatile uint32_t *)0xE0001000u)
+#define CC_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004u)
+#define CC_DWT_LAR (*(volatile uint32_t *)0xE0001FB0u)
+
+static uint32_t CC_DWT_Cycles(void)
+{
+    return CC_DWT_CYCCNT;
+}
+
+void CC_DWT_init(void)
+{
+    CC_DEMCR |= (1u << 24); /* TRCENA */
+    CC_DWT_LAR = 0xC5ACCE55u; /* Unlocks the DWT on Cortex-M7, ignored elsewhere */
+    CC_DWT_CYCCNT = 0;
+    CC_DWT_CTRL |= 1u; /* CYCCNTENA */
+    CC_get_cycles = CC_DWT_Cycles;
 }
 
+#endif
+
 /**
- * @brief Initializes the CAN TX instance with message table and function callbacks.
+ * @brief Reads the registered cycle counter.
  *
- * Sets the TX message table, its size, and function pointers for
- * sending messages and checking bus availability.
- *
- * @param Instance Pointer to the TX instance to initialize.
- * @param TxTable Pointer to the TX message registration table.
- * @param TableSize Number of entries in the TxTable.
- * @param SendFunction Callback function to send a CAN message.
- * @param BusCheck Callback function to check if the CAN bus is free.
+ * @return uint32_t Current cycle count, 0 if no counter is registered.
  */
-void CC_TX_init(CC_TX_instance_t *Instance, CC_TX_table_t *TxTable, uint16_t TableSize,
-                void (*SendFunction)(const CC_TX_instance_t *Instance, const CC_TX_message_t *msg),
-                CC_BusIsFree_t (*BusCheck)(const CC_TX_instance_t *Instance))
+static inline uint32_t CC_Cycles(void)
 {
-    Instance->TxTable = TxTable;
-    Instance->TableSize = TableSize;
-    Instance->SendFunction = SendFunction;
-    Instance->BusCheck = BusCheck;
+    return (NULL != CC_get_cycles) ? CC_get_cycles() : 0u;
 }
 
+#endif
+
+#if CC_PROFILE
 /**
- * @brief Copies a buffer of bytes from source to destination.
- *
- * This function copies `size` bytes from the memory area pointed to by `src`
- * to the memory area pointed to by `dst`. The `restrict` qualifier indicates
- * that the source and destination buffers do not overlap.
+ * @brief Adds one measured call to the cycle counts of a poll stage.
  *
- * @param[in] src Pointer to the source buffer.
- * @param[out] dst Pointer to the destination buffer.
- * @param[in] size Number of bytes to copy.
+ * @param[in,out] Profile Pointer to the cycle counts of the stage.
+ * @param[in] Start Cycle count read when the call started.
+ * @param[in] Items Number of items processed by the call.
  */
-static inline void CopyBuf(uint8_t *restrict src, uint8_t *restrict dst, size_t size)
+static inline void CC_Profile_Add(CC_profile_t *Profile, uint32_t Start, uint32_t Items)
 {
-    assert((src != NULL) && (dst != NULL));
+    uint32_t Cycles = CC_Cycles() - Start;
 
-    for (size_t i = 0; i < size; i++)
+    Profile->Calls++;
+    Profile->Items += Items;
+    Profile->Cycles += Cycles;
+    if (Cycles > Profile->Max)
     {
-        dst[i] = src[i];
+        Profile->Max = Cycles;
     }
 }
+#endif
 
+#if CC_LATENCY
 /**
- * @brief Pushes a raw CAN message into the RX instance buffer.
+ * @brief Adds one sample to a latency histogram.
  *
- * This function should be called from lower-level CAN driver code when
- * a new raw CAN frame is received. It copies the received frame data into
- * the RX buffer of the provided instance.
- *
- * @param[in,out] Instance Pointer to the RX instance where the message will be stored.
- * @param[in] ID CAN message identifier.
- * @param[in] Data Pointer to the data bytes of the CAN message.
- * @param[in] DLC Data length code (number of valid bytes in Data, max 8).
- * @param[in] IDE_flag Identifier extension flag (0 for standard 11-bit ID, 1 for extended 29-bit ID).
+ * @param[in,out] Hist Pointer to the histogram.
+ * @param[in] Cycles Latency in cycles.
  */
-void CC_RX_PushMsg(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag)
+static inline void CC_Hist_Add(CC_hist_t *Hist, uint32_t Cycles)
 {
-    assert(Instance != NULL);
+    uint32_t Bin = 0;
 
-    uint16_t next_head = Instance->Head + 1;
-    if (next_head >= CC_RX_BUFFER_SIZE)
+#if defined(__GNUC__)
+    if (0u != Cycles)
     {
-        next_head = 0;
+        Bin = (uint32_t)(sizeof(unsigned long) * CHAR_BIT) - (uint32_t)__builtin_clzl(Cycles);
     }
-
-    if (next_head == Instance->Tail)
+#else
+    for (uint32_t Rest = Cycles; 0u != Rest; Rest >>= 1)
     {
-        return;
+        Bin++;
     }
-
-    Instance->Head = next_head;
-
-    Instance->Buf[Instance->Head].ID = ID;
-    Instance->Buf[Instance->Head].DLC = DLC;
-    Instance->Buf[Instance->Head].IDE_flag = IDE_flag;
-    Instance->Buf[Instance->Head].Time = CC_GET_TICK;
-
-    if ((DLC > 0) && (DLC <= 8))
+#endif
+    if (Bin >= CC_LATENCY_BINS)
+    {
+        Bin = CC_LATENCY_BINS - 1u;
+    }
+    Hist->Bins[Bin]++;
+    if (Cycles > Hist->Max)
     {
-        CopyBuf(Data, Instance->Buf[Instance->Head].Data, DLC);
+        Hist->Max = Cycles;
     }
 }
+#endif
 
 /**
- * @brief Helper function to search for a received message in the RX message table.
+ * @brief Reads the tick source of an RX or TX instance.
  *
- * This function checks if the given received message matches any entry in the RX
- * table of the specified instance. It returns the registration status indicating
- * whether the message is registered or unregistered.
+ * Uses the instance tick source if one is registered, the global one otherwise.
+ */
+#define CC_INSTANCE_TICK(Instance) ((NULL != (Instance)->GetTick) ? (Instance)->GetTick() : CC_GET_TICK)
+
+/**
+ * @brief Initializes the index state of an empty ring buffer.
  *
- * @param[in] Instance Pointer to the RX instance containing the RX table.
- * @param[in] Msg Pointer to the received CAN message to search for.
- * @return CC_MsgRegStatus_t Returns CC_MSG_REG if the message is registered in the table,
- *         otherwise CC_MSG_UNREG.
+ * @param[out] Ring Pointer to the ring.
+ * @param[in] Size Number of slots in the ring (at least 2).
  */
-static inline CC_MsgRegStatus_t CC_RX_MsgFromTables(CC_RX_instance_t *Instance, CC_RX_message_t *Msg)
+static inline void CC_Ring_Init(CC_ring_t *Ring, uint16_t Size)
 {
-    assert(Instance != NULL);
+    Ring->Size = Size;
+    Ring->Mask = ((Size & (Size - 1u)) == 0u) ? (uint16_t)(Size - 1u) : (uint16_t)0;
+    CC_Index_Release(&Ring->Head, 0);
+    CC_Index_Release(&Ring->Tail, 0);
+}
 
-    if (NULL == Instance->RxTable)
+/**
+ * @brief Advances a ring buffer index by one slot.
+ *
+ * Uses a mask when the ring size is a power of two, compare-and-reset otherwise.
+ *
+ * @param[in] Ring Pointer to the ring.
+ * @param[in] Index Current index.
+ * @return uint16_t Next index.
+ */
+static inline uint16_t CC_Ring_Next(const CC_ring_t *Ring, uint16_t Index)
+{
+    if (0u != Ring->Mask)
     {
-        return CC_MSG_UNREG;
+        return (uint16_t)((Index + 1u) & Ring->Mask);
     }
 
-    for (uint16_t i = 0; i < Instance->TableSize; i++)
-    {
-        if (Instance->RxTable[i].ID == Msg->ID)
-        {
-            if ((Instance->RxTable[i].DLC == Msg->DLC) && (Instance->RxTable[i].IDE_flag == Msg->IDE_flag))
-            {
-                Instance->RxTable[i].Parser(Instance, Msg, Instance->RxTable[i].SlotNo);
-                Instance->RxTable[i].LastTick = Msg->Time;
-                return CC_MSG_REG;
-            }
-        }
-    }
-    return CC_MSG_UNREG;
+    Index++;
+    return (Index >= Ring->Size) ? (uint16_t)0 : Index;
 }
 
 /**
- * @brief Helper function to check for message timeouts in the RX instance.
- *
- * This function iterates through the RX message table of the given instance,
- * checking if any registered message has exceeded its configured timeout period.
- * If a timeout is detected, the user-defined TimeoutCallback function is called
- * for the respective message slot.
+ * @brief Computes the number of free slots between two ring buffer indices.
  *
- * @param[in] Instance Pointer to the RX instance to check for timeouts.
+ * @param[in] Ring Pointer to the ring.
+ * @param[in] Head Index of the last written slot.
+ * @param[in] Tail Index of the last consumed slot.
+ * @return uint16_t Number of elements that can still be pushed.
  */
-static void CC_Timeout_Check(CC_RX_instance_t *Instance)
+static inline uint16_t CC_Ring_FreeAt(const CC_ring_t *Ring, uint16_t Head, uint16_t Tail)
 {
-    if (NULL != Instance->RxTable)
-    {
-        for (uint16_t i = 0; i < Instance->TableSize; i++)
-        {
-            if ((0 != Instance->RxTable[i].TimeOut) &&
-                (CC_GET_TICK - Instance->RxTable[i].LastTick >= Instance->RxTable[i].TimeOut))
-            {
-                Instance->RxTable[i].LastTick = CC_GET_TICK;
-                if (NULL != Instance->TimeoutCallback)
-                {
-                    Instance->TimeoutCallback(Instance, Instance->RxTable[i].SlotNo);
-                }
-            }
-        }
-    }
+    return (Tail > Head) ? (uint16_t)(Tail - Head - 1u) : (uint16_t)(Ring->Size - 1u - (Head - Tail));
 }
 
 /**
- * @brief Processes received CAN messages and handles timeouts.
+ * @brief Returns the number of elements that the producer can still push.
  *
- * This function should be called regularly in the main loop.
- * It processes all pending messages in the RX buffer, attempts to parse them using
- * the registered parsers or the unregistered message parser if applicable,
- * and checks for message timeouts by invoking timeout callbacks.
+ * Producer side only.
  *
- * @param[in,out] Instance Pointer to the RX instance to process.
+ * @param[in] Ring Pointer to the ring.
+ * @return uint16_t Number of free slots.
  */
-void CC_RX_Poll(CC_RX_instance_t *Instance)
+static inline uint16_t CC_Ring_Free(CC_ring_t *Ring)
 {
-    assert(Instance != NULL);
+    return CC_Ring_FreeAt(Ring, CC_Index_Load(&Ring->Head), CC_Index_Acquire(&Ring->Tail));
+}
 
-    CC_Timeout_Check(Instance);
+/**
+ * @brief Returns the slot the producer writes next.
+ *
+ * Producer side only. The slot is published with CC_Ring_Commit.
+ *
+ * @param[in] Ring Pointer to the ring.
+ * @param[out] Idx Index of the slot.
+ * @return uint16_t Number of free slots before the push, 0 if the ring is full.
+ */
+static inline uint16_t CC_Ring_Reserve(CC_ring_t *Ring, uint16_t *Idx)
+{
+    uint16_t head = CC_Index_Load(&Ring->Head);
+    uint16_t Free = CC_Ring_FreeAt(Ring, head, CC_Index_Acquire(&Ring->Tail));
 
-    while (Instance->Head != Instance->Tail)
-    {
-        Instance->Tail++;
-        if (Instance->Tail >= CC_RX_BUFFER_SIZE)
-        {
-            Instance->Tail = 0;
-        }
+    *Idx = CC_Ring_Next(Ring, head);
+    return Free;
+}
 
-        if ((CC_RX_MsgFromTables(Instance, &Instance->Buf[Instance->Tail]) != CC_MSG_REG) &&
-            NULL != Instance->Parser_unreg_msg)
-        {
-            Instance->Parser_unreg_msg(Instance, &Instance->Buf[Instance->Tail]);
-        }
-    }
+/**
+ * @brief Publishes the slot returned by CC_Ring_Reserve.
+ *
+ * Producer side only.
+ *
+ * @param[in,out] Ring Pointer to the ring.
+ */
+static inline void CC_Ring_Commit(CC_ring_t *Ring)
+{
+    CC_Index_Release(&Ring->Head, CC_Ring_Next(Ring, CC_Index_Load(&Ring->Head)));
 }
 
 /**
- * @brief Asynchronously sends a CAN message by pushing it into the TX buffer.
+ * @brief Returns the oldest unread elements as one contiguous run.
  *
- * This function places a new message into the transmit buffer of the specified
- * TX instance. It can be used to send messages outside of the configured TX table.
+ * Consumer side only. The run ends at the ring head or at the end of the
+ * storage, whichever comes first.
  *
- * @param[in,out] Instance Pointer to the TX instance where the message will be queued.
- * @param[in] ID        CAN message identifier.
- * @param[in] Data      Pointer to the data bytes to be sent (up to 8 bytes).
- * @param[in] DLC       Data Length Code (number of valid bytes in Data).
- * @param[in] IDE_flag  Identifier Extension flag (0 for standard, 1 for extended).
+ * @param[in] Ring Pointer to the ring.
+ * @param[out] Idx Index of the first element of the run.
+ * @return uint16_t Number of elements in the run, 0 if the ring is empty.
  */
-void CC_TX_PushMsg(CC_TX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag)
+static inline uint16_t CC_Ring_Peek(CC_ring_t *Ring, uint16_t *Idx)
 {
-    assert(Instance != NULL);
+    uint16_t tail = CC_Index_Load(&Ring->Tail);
+    uint16_t head = CC_Index_Acquire(&Ring->Head);
 
-    uint16_t next_head = Instance->Head + 1;
-    if (next_head >= CC_RX_BUFFER_SIZE)
+    if (head == tail)
     {
-        next_head = 0;
+        return 0;
     }
 
-    if (next_head == Instance->Tail)
+    uint16_t start = CC_Ring_Next(Ring, tail);
+    *Idx = start;
+    return (head >= start) ? (uint16_t)(head - start + 1u) : (uint16_t)(Ring->Size - start);
+}
+
+/**
+ * @brief Releases the first `Count` elements returned by CC_Ring_Peek.
+ *
+ * Consumer side only.
+ *
+ * @param[in,out] Ring Pointer to the ring.
+ * @param[in] Count Number of elements to release.
+ */
+static inline void CC_Ring_Release(CC_ring_t *Ring, uint16_t Count)
+{
+    if (Count > 0)
     {
-        return;
+        uint32_t tail = (uint32_t)CC_Index_Load(&Ring->Tail) + Count;
+        if (tail >= Ring->Size)
+        {
+            tail -= Ring->Size;
+        }
+        CC_Index_Release(&Ring->Tail, (uint16_t)tail);
     }
+}
 
-    Instance->Head = next_head;
+/**
+ * @brief Returns the scheduler node stored at a given heap position.
+ *
+ * @param[in] Sched Pointer to the scheduler.
+ * @param[in] Pos Heap position.
+ * @return CC_sched_node_t* Pointer to the node.
+ */
+static inline CC_sched_node_t *CC_Sched_Node(const CC_sched_t *Sched, uint16_t Pos)
+{
+    return (CC_sched_node_t *)(void *)(Sched->Base + (size_t)Pos * Sched->Stride);
+}
 
-    Instance->Buf[Instance->Head].ID = ID;
-    Instance->Buf[Instance->Head].DLC = DLC;
-    Instance->Buf[Instance->Head].IDE_flag = IDE_flag;
+/**
+ * @brief Computes the number of ticks left until a node is due.
+ *
+ * @param[in] Node Pointer to the scheduler node.
+ * @param[in] Now Current system tick.
+ * @return CC_TIME_VAL_t Ticks left, or 0 if the node is already due.
+ */
+static inline CC_TIME_VAL_t CC_Sched_Remaining(const CC_sched_node_t *Node, CC_TIME_VAL_t Now)
+{
+    CC_TIME_VAL_t Elapsed = (CC_TIME_VAL_t)(Now - Node->Start);
 
-    if ((DLC > 0) && (DLC <= 8))
-    {
-        CopyBuf(Data, Instance->Buf[Instance->Head].Data, DLC);
-    }
+    return (Elapsed >= Node->Period) ? (CC_TIME_VAL_t)0 : (CC_TIME_VAL_t)(Node->Period - Elapsed);
 }
 
 /**
- * @brief Helper function that processes TX messages from the transmit table.
+ * @brief Restores the heap order below a given position.
  *
- * This internal function iterates through the TX message table in the given instance,
- * updating and preparing messages for transmission according to their configured parameters.
+ * Nodes are compared by their remaining time, which shrinks at the same rate for
+ * every node and saturates at zero, so the heap order stays valid as time passes.
  *
- * @param[in,out] Instance Pointer to the TX instance whose TX table will be processed.
+ * @param[in,out] Sched Pointer to the scheduler.
+ * @param[in] Pos Heap position to sift down from.
+ * @param[in] Now Current system tick.
  */
-static inline void CC_TX_MsgFromTables(CC_TX_instance_t *Instance)
+static void CC_Sched_SiftDown(CC_sched_t *Sched, uint16_t Pos, CC_TIME_VAL_t Now)
 {
-    assert(NULL != Instance);
-    uint8_t Temp[8];
+    CC_sched_node_t Node = *CC_Sched_Node(Sched, Pos);
+    CC_TIME_VAL_t Remaining = CC_Sched_Remaining(&Node, Now);
 
-    for (uint16_t i = 0; i < Instance->TableSize; i++)
+    for (;;)
     {
-        if (CC_GET_TICK - Instance->TxTable[i].LastTick >= Instance->TxTable[i].SendFreq)
+        uint32_t Child = 2u * Pos + 1u;
+        if (Child >= Sched->Count)
         {
-            Instance->TxTable[i].LastTick = CC_GET_TICK;
-            CopyBuf(Instance->TxTable[i].Data, Temp, Instance->TxTable[i].DLC);
-            if (NULL != Instance->TxTable[i].Parser)
+            break;
+        }
+
+        CC_TIME_VAL_t ChildRemaining = CC_Sched_Remaining(CC_Sched_Node(Sched, (uint16_t)Child), Now);
+        if (Child + 1u < Sched->Count)
+        {
+            CC_TIME_VAL_t RightRemaining = CC_Sched_Remaining(CC_Sched_Node(Sched, (uint16_t)(Child + 1u)), Now);
+            if (RightRemaining < ChildRemaining)
             {
-                Instance->TxTable[i].Parser(Instance, Temp, &Instance->TxTable[i]);
+                Child++;
+                ChildRemaining = RightRemaining;
             }
-            CC_TX_PushMsg(Instance, Instance->TxTable[i].ID, Temp, Instance->TxTable[i].DLC,
-                          Instance->TxTable[i].IDE_flag);
         }
+
+        if (Remaining <= ChildRemaining)
+        {
+            break;
+        }
+
+        *CC_Sched_Node(Sched, Pos) = *CC_Sched_Node(Sched, (uint16_t)Child);
+        Pos = (uint16_t)Child;
     }
+    *CC_Sched_Node(Sched, Pos) = Node;
 }
 
 /**
- * @brief Poll function to handle CAN transmission for a single TX instance.
+ * @brief Binds a scheduler to the nodes embedded in a table.
  *
- * This function should be called regularly in the main loop. It manages the transmission
- * of CAN messages by checking the bus state, preparing messages from the TX table, and
- * invoking the configured send function when the bus is free.
+ * Heap order is established later by CC_Sched_Prepare, once a tick is available.
  *
- * @param[in,out] Instance Pointer to the TX instance to be processed.
+ * @param[out] Sched Pointer to the scheduler.
+ * @param[in] Base Address of the node embedded in the first table entry.
+ * @param[in] Stride Size of one table entry in bytes.
  */
-void CC_TX_Poll(CC_TX_instance_t *Instance)
+static void CC_Sched_Init(CC_sched_t *Sched, void *Base, uint16_t Stride)
 {
-    assert((NULL != Instance) && (NULL != Instance->BusCheck));
-
-    CC_TX_MsgFromTables(Instance);
+    Sched->Base = (uint8_t *)Base;
+    Sched->Stride = Stride;
+    Sched->Count = 0;
+    Sched->Ready = 0;
+}
 
-    while ((Instance->Head != Instance->Tail) && (Instance->BusCheck(Instance) == CC_BUS_FREE))
-    {
-        Instance->Tail++;
-        if (Instance->Tail >= CC_TX_BUFFER_SIZE)
+/**
+ * @brief Appends a node to the scheduler without restoring the heap order.
+ *
+ * @param[in,out] Sched Pointer to the scheduler.
+ * @param[in] Idx Table position of the entry the node belongs to.
+ * @param[in] Start Tick at which the first period starts.
+ * @param[in] Period Length of the period in system ticks.
+ */
+static void CC_Sched_Add(CC_sched_t *Sched, uint16_t Idx, CC_TIME_VAL_t Start, CC_TIME_VAL_t Period)
+{
+    CC_sched_node_t *Node = CC_Sched_Node(Sched, Sched->Count);
+
+    Node->Start = Start;
+    Node->Period = Period;
+    Node->Idx = Idx;
+    Sched->Count++;
+    Sched->Ready = 0;
+}
+
+/**
+ * @brief Establishes the heap order on first use.
+ *
+ * @param[in,out] Sched Pointer to the scheduler.
+ * @param[in] Now Current system tick.
+ */
+static inline void CC_Sched_Prepare(CC_sched_t *Sched, CC_TIME_VAL_t Now)
+{
+    if (!Sched->Ready)
+    {
+        for (uint16_t Pos = Sched->Count / 2u; Pos-- > 0;)
+        {
+            CC_Sched_SiftDown(Sched, Pos, Now);
+        }
+        Sched->Ready = 1;
+    }
+}
+
+/**
+ * @brief Returns the earliest node if it is due.
+ *
+ * @param[in] Sched Pointer to the scheduler.
+ * @param[in] Now Current system tick.
+ * @return CC_sched_node_t* Pointer to the earliest node, or NULL if nothing is due.
+ */
+static inline CC_sched_node_t *CC_Sched_Due(const CC_sched_t *Sched, CC_TIME_VAL_t Now)
+{
+    if ((0 == Sched->Count) || (0 != CC_Sched_Remaining(CC_Sched_Node(Sched, 0), Now)))
+    {
+        return NULL;
+    }
+    return CC_Sched_Node(Sched, 0);
+}
+
+/**
+ * @brief Starts a new period for the earliest node and restores the heap order.
+ *
+ * @param[in,out] Sched Pointer to the scheduler.
+ * @param[in] Start Tick at which the new period starts.
+ * @param[in] Period Length of the new period in system ticks.
+ * @param[in] Now Current system tick.
+ */
+static inline void CC_Sched_Reschedule(CC_sched_t *Sched, CC_TIME_VAL_t Start, CC_TIME_VAL_t Period, CC_TIME_VAL_t Now)
+{
+    CC_sched_node_t *Node = CC_Sched_Node(Sched, 0);
+
+    Node->Start = Start;
+    Node->Period = Period;
+    CC_Sched_SiftDown(Sched, 0, Now);
+}
+
+/**
+ * @brief Removes the earliest node from the scheduler and restores the heap order.
+ *
+ * The last node takes its heap position; the storage of the last position is no
+ * longer part of the heap afterwards.
+ *
+ * @param[in,out] Sched Pointer to the scheduler.
+ * @param[in] Now Current system tick.
+ */
+static inline void CC_Sched_Remove(CC_sched_t *Sched, CC_TIME_VAL_t Now)
+{
+    Sched->Count--;
+    if (0 != Sched->Count)
+    {
+        *CC_Sched_Node(Sched, 0) = *CC_Sched_Node(Sched, Sched->Count);
+        CC_Sched_SiftDown(Sched, 0, Now);
+    }
+}
+
+/**
+ * @brief Converts a DLC code to the number of payload bytes.
+ *
+ * @param[in] DLC Data Length Code (0-15).
+ * @param[in] FDF_flag FD Format flag (0 = classic CAN, 1 = CAN FD).
+ * @return uint8_t Number of payload bytes.
+ */
+uint8_t CC_DlcToLen(uint8_t DLC, uint8_t FDF_flag)
+{
+    static const uint8_t FdLen[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+    DLC &= 0x0Fu;
+    if (DLC <= 8)
+    {
+        return DLC;
+    }
+    return FDF_flag ? FdLen[DLC] : (uint8_t)8;
+}
+
+/**
+ * @brief Converts a payload length to the smallest DLC code that can hold it.
+ *
+ * @param[in] Len Number of payload bytes (0-64).
+ * @return uint8_t Data Length Code (0-15).
+ */
+uint8_t CC_LenToDlc(uint8_t Len)
+{
+    if (Len <= 8)
+    {
+        return Len;
+    }
+    if (Len <= 24)
+    {
+        return (uint8_t)(9u + (Len - 9u) / 4u);
+    }
+    if (Len <= 32)
+    {
+        return 13;
+    }
+    return (Len <= 48) ? (uint8_t)14 : (uint8_t)15;
+}
+
+/**
+ * @brief Builds the lookup key of a CAN identifier.
+ *
+ * Packs the IDE flag above the 29-bit identifier so that standard and extended
+ * frames with the same numeric ID get distinct keys.
+ *
+ * @param[in] ID CAN message identifier.
+ * @param[in] IDE_flag Identifier extension flag.
+ * @return uint32_t Packed lookup key.
+ */
+static inline uint32_t CC_RX_Key(uint32_t ID, uint8_t IDE_flag)
+{
+    return ((uint32_t)(IDE_flag & 1u) << 31) | (ID & 0x1FFFFFFFu);
+}
+
+/**
+ * @brief Helper function to compute the sort order of a table entry in the lookup index.
+ *
+ * The table position below the key breaks ties, so entries sharing a key are ordered
+ * by table position.
+ *
+ * @param[in] Table Pointer to the RX table.
+ * @param[in] Idx Table position of the entry.
+ * @return uint64_t Sort value, unique per entry.
+ */
+static inline uint64_t CC_RX_IndexOrder(const CC_RX_table_t *Table, uint16_t Idx)
+{
+    return ((uint64_t)CC_RX_Key(Table[Idx].ID, Table[Idx].IDE_flag) << 16) | Idx;
+}
+
+/**
+ * @brief Helper function to restore the max-heap order of the lookup index below a position.
+ *
+ * @param[in,out] Table Pointer to the RX table holding the index in `LookupIdx`.
+ * @param[in] Pos Heap position to sift down from.
+ * @param[in] Count Number of index entries in the heap.
+ */
+static void CC_RX_IndexSiftDown(CC_RX_table_t *Table, uint16_t Pos, uint16_t Count)
+{
+    uint16_t Idx = Table[Pos].LookupIdx;
+    uint64_t Order = CC_RX_IndexOrder(Table, Idx);
+
+    for (;;)
+    {
+        uint32_t Child = 2u * Pos + 1u;
+        if (Child >= Count)
+        {
+            break;
+        }
+
+        uint64_t ChildOrder = CC_RX_IndexOrder(Table, Table[Child].LookupIdx);
+        if (Child + 1u < Count)
+        {
+            uint64_t RightOrder = CC_RX_IndexOrder(Table, Table[Child + 1u].LookupIdx);
+            if (RightOrder > ChildOrder)
+            {
+                Child++;
+                ChildOrder = RightOrder;
+            }
+        }
+
+        if (Order >= ChildOrder)
+        {
+            break;
+        }
+
+        Table[Pos].LookupIdx = Table[Child].LookupIdx;
+        Pos = (uint16_t)Child;
+    }
+    Table[Pos].LookupIdx = Idx;
+}
+
+/**
+ * @brief Helper function to build the sorted lookup index of the RX table.
+ *
+ * Stores a permutation of table positions ordered by lookup key in the `LookupIdx`
+ * field of the table entries. Heap sort keeps the build in place and O(n log n);
+ * the table position breaks ties, so entries sharing the same key keep their table
+ * order as with a stable sort.
+ *
+ * @param[in,out] Instance Pointer to the RX instance whose table will be indexed.
+ */
+static void CC_RX_IndexBuild(CC_RX_instance_t *Instance)
+{
+    CC_RX_table_t *Table = Instance->RxTable;
+    uint16_t Count = Instance->TableSize;
+
+    for (uint16_t i = 0; i < Count; i++)
+    {
+        Table[i].LookupIdx = i;
+    }
+    for (uint16_t Pos = Count / 2u; Pos-- > 0;)
+    {
+        CC_RX_IndexSiftDown(Table, Pos, Count);
+    }
+    while (Count > 1u)
+    {
+        uint16_t Last = Table[Count - 1u].LookupIdx;
+
+        Count--;
+        Table[Count].LookupIdx = Table[0].LookupIdx;
+        Table[0].LookupIdx = Last;
+        CC_RX_IndexSiftDown(Table, 0, Count);
+    }
+}
+
+/**
+ * @brief Initializes the CAN RX instance with message table and callbacks.
+ *
+ * Sets the RX message table, its size, and function pointers for
+ * parsing unregistered messages and handling timeouts. Builds the
+ * lookup index used for message dispatch.
+ *
+ * @param Instance Pointer to the RX instance to initialize.
+ * @param Buf Pointer to the storage of the receive buffer.
+ * @param BufSize Number of messages in Buf (at least 2).
+ * @param RxTable Pointer to the RX message registration table.
+ * @param TableSize Number of entries in the RxTable.
+ * @param Parser_unreg_msg Callback for parsing unregistered messages.
+ * @param TimeoutCallback Callback for timeout handling.
+ */
+void CC_RX_init(CC_RX_instance_t *Instance, CC_RX_message_t *Buf, uint16_t BufSize, CC_RX_table_t *RxTable,
+                uint16_t TableSize,
+                void (*Parser_unreg_msg)(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg),
+                void (*TimeoutCallback)(CC_RX_instance_t *Instance, uint16_t Slot))
+{
+    assert((NULL != Instance) && (NULL != Buf) && (BufSize >= 2));
+
+    Instance->Buf = Buf;
+    CC_Ring_Init(&Instance->Ring, BufSize);
+#if CC_FD_SUPPORT
+    Instance->PayloadSize = 0;
+#endif
+#if CC_STATS_ENABLE
+    Instance->Stats = (CC_RX_stats_t){0};
+#endif
+#if CC_PROFILE
+    Instance->Profile = (CC_RX_profile_t){0};
+#endif
+#if CC_LATENCY
+    Instance->Latency = (CC_RX_latency_t){0};
+    Instance->SlotLatency = NULL;
+#endif
+    Instance->RxTable = RxTable;
+    Instance->TableSize = TableSize;
+    Instance->Parser_unreg_msg = Parser_unreg_msg;
+    Instance->TimeoutCallback = TimeoutCallback;
+    Instance->Keys = NULL;
+    Instance->KeyIdx = NULL;
+    Instance->Dispatch = NULL;
+    Instance->GetTick = NULL;
+    Instance->WakeCallback = NULL;
+    Instance->HighWaterCallback = NULL;
+    Instance->HighWaterLevel = 0;
+    Instance->Hooks = NULL;
+#if CC_TRACE
+    Instance->Trace = NULL;
+#endif
+#if CC_RX_MAILBOX
+    Instance->MailboxCount = 0;
+    CC_Index_Release(&Instance->MailboxHead, 0);
+    CC_Index_Release(&Instance->MailboxTail, 0);
+#endif
+#if CC_GATEWAY
+    Instance->Routes = NULL;
+    Instance->RouteCount = 0;
+    Instance->RouteIsr = 0;
+#endif
+#if CC_SYNC_MODE == CC_SYNC_C11
+    Instance->Group = NULL;
+    Instance->GroupBit = 0;
+#endif
+
+    CC_Sched_Init(&Instance->TimeoutSched, NULL, sizeof(CC_RX_table_t));
+
+    if (NULL != RxTable)
+    {
+        CC_RX_IndexBuild(Instance);
+
+        Instance->TimeoutSched.Base = (uint8_t *)&RxTable->Sched;
+        for (uint16_t i = 0; i < TableSize; i++)
+        {
+            if (0 != RxTable[i].TimeOut)
+            {
+                CC_Sched_Add(&Instance->TimeoutSched, i, RxTable[i].LastTick, RxTable[i].TimeOut);
+            }
+#if CC_RX_MAILBOX
+            if (CC_RX_MODE_LATEST == RxTable[i].Mode)
+            {
+                assert((NULL != RxTable[i].Mailbox) && (Instance->MailboxCount < 0x7FFFu));
+
+                CC_Index_Release(&RxTable[i].Mailbox->Seq, 0);
+                CC_Index_Release(&RxTable[i].Mailbox->Read, 0);
+                CC_Index_Release(&RxTable[i].Mailbox->Posted, 0);
+                CC_Index_Release(&RxTable[i].Mailbox->Drained, 0);
+                Instance->MailboxCount++;
+            }
+#endif
+        }
+    }
+}
+
+/**
+ * @brief Attaches a structure-of-arrays copy of the RX table match keys.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[out] Keys Pointer to an array of `TableSize` keys.
+ * @param[out] KeyIdx Pointer to an array of `TableSize` table positions.
+ */
+void CC_RX_Keys_init(CC_RX_instance_t *Instance, uint32_t *Keys, uint16_t *KeyIdx)
+{
+    assert((NULL != Instance) && (NULL != Instance->RxTable) && (NULL != Keys) && (NULL != KeyIdx));
+
+    CC_RX_table_t *Table = Instance->RxTable;
+
+    for (uint16_t i = 0; i < Instance->TableSize; i++)
+    {
+        CC_RX_table_t *Entry = &Table[Table[i].LookupIdx];
+
+        Keys[i] = CC_RX_Key(Entry->ID, Entry->IDE_flag);
+        KeyIdx[i] = Table[i].LookupIdx;
+    }
+    Instance->Keys = Keys;
+    Instance->KeyIdx = KeyIdx;
+}
+
+/**
+ * @brief Registers a dispatch function for the RX table of an instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in] Function Pointer to the dispatch function, or NULL for the table lookup.
+ */
+void CC_RX_dispatch_function_register(CC_RX_instance_t *Instance,
+                                      CC_RX_table_t *(*Function)(const CC_RX_instance_t *Instance,
+                                                                 CC_RX_message_t *Msg))
+{
+    assert(NULL != Instance);
+
+    Instance->Dispatch = Function;
+}
+
+/**
+ * @brief Attaches a protocol handler to an RX instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in,out] Hook Pointer to the handler.
+ */
+void CC_RX_Hook_attach(CC_RX_instance_t *Instance, CC_RX_hook_t *Hook)
+{
+    assert((NULL != Instance) && (NULL != Hook) && (NULL != Hook->Handler));
+
+    CC_RX_hook_t **Link = &Instance->Hooks;
+
+    while (NULL != *Link)
+    {
+        assert(*Link != Hook);
+        Link = &(*Link)->Next;
+    }
+    Hook->Next = NULL;
+    *Link = Hook;
+}
+
+/**
+ * @brief Registers the wakeup callbacks of an RX instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in] Wake Pointer to the wakeup callback, or NULL.
+ * @param[in] HighWater Pointer to the high-water callback, or NULL.
+ * @param[in] HighWaterLevel Fill level firing HighWater.
+ */
+void CC_RX_Notify_init(CC_RX_instance_t *Instance, void (*Wake)(CC_RX_instance_t *Instance),
+                       void (*HighWater)(CC_RX_instance_t *Instance, uint16_t Level), uint16_t HighWaterLevel)
+{
+    assert((NULL != Instance) &&
+           ((NULL == HighWater) || ((HighWaterLevel > 0) && (HighWaterLevel < Instance->Ring.Size))));
+
+    Instance->WakeCallback = Wake;
+    Instance->HighWaterCallback = HighWater;
+    Instance->HighWaterLevel = HighWaterLevel;
+}
+
+#if CC_GATEWAY
+/**
+ * @brief Attaches a gateway routing table to an RX instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in] Routes Pointer to the routing table, or NULL.
+ * @param[in] RouteCount Number of entries in Routes.
+ */
+void CC_RX_Routes_init(CC_RX_instance_t *Instance, const CC_route_t *Routes, uint16_t RouteCount)
+{
+    assert((NULL != Instance) && ((NULL != Routes) || (0 == RouteCount)));
+
+    uint16_t Isr = 0;
+
+    for (uint16_t i = 0; i < RouteCount; i++)
+    {
+        assert(NULL != Routes[i].Dest);
+
+        if (0 != (Routes[i].Flags & CC_ROUTE_ISR))
+        {
+            Isr++;
+        }
+    }
+
+    Instance->RouteIsr = Isr;
+    Instance->Routes = Routes;
+    Instance->RouteCount = RouteCount;
+}
+#endif
+
+/**
+ * @brief Initializes the CAN TX instance with message table and function callbacks.
+ *
+ * Sets the TX message table, its size, and function pointers for
+ * sending messages and checking bus availability.
+ *
+ * @param Instance Pointer to the TX instance to initialize.
+ * @param Buf Pointer to the storage of the transmit buffer.
+ * @param BufSize Number of messages in Buf (at least 2).
+ * @param TxTable Pointer to the TX message registration table.
+ * @param TableSize Number of entries in the TxTable.
+ * @param SendFunction Callback function to send a CAN message.
+ * @param BusCheck Callback function to check if the CAN bus is free.
+ */
+void CC_TX_init(CC_TX_instance_t *Instance, CC_TX_message_t *Buf, uint16_t BufSize, CC_TX_table_t *TxTable,
+                uint16_t TableSize,
+                void (*SendFunction)(const CC_TX_instance_t *Instance, const CC_TX_message_t *msg),
+                CC_BusIsFree_t (*BusCheck)(const CC_TX_instance_t *Instance))
+{
+    assert((NULL != Instance) && (NULL != Buf) && (BufSize >= 2));
+
+    Instance->Buf = Buf;
+    CC_Ring_Init(&Instance->Ring, BufSize);
+#if CC_FD_SUPPORT
+    Instance->PayloadSize = 0;
+#endif
+#if CC_TX_PRIORITY_QUEUE
+    Instance->Count = 0;
+    Instance->Seq = 0;
+#endif
+#if CC_STATS_ENABLE
+    Instance->Stats = (CC_TX_stats_t){0};
+#endif
+#if CC_PROFILE
+    Instance->Profile = (CC_TX_profile_t){0};
+#endif
+#if CC_LATENCY
+    Instance->Latency = (CC_hist_t){0};
+#endif
+    Instance->TxTable = TxTable;
+    Instance->TableSize = TableSize;
+    Instance->SendFunction = SendFunction;
+    Instance->BusCheck = BusCheck;
+    Instance->FreeSlots = NULL;
+    Instance->SendBatch = NULL;
+    Instance->GetTick = NULL;
+    Instance->WakeCallback = NULL;
+#if CC_TRACE
+    Instance->Trace = NULL;
+#endif
+
+    CC_Sched_Init(&Instance->SendSched, NULL, sizeof(CC_TX_table_t));
+
+    if (NULL != TxTable)
+    {
+        Instance->SendSched.Base = (uint8_t *)&TxTable->Sched;
+        for (uint16_t i = 0; i < TableSize; i++)
+        {
+            CC_TX_table_t *Entry = &TxTable[i];
+            CC_TIME_VAL_t Phase = (0 != Entry->SendFreq) ? (CC_TIME_VAL_t)(Entry->Offset % Entry->SendFreq) : 0;
+
+#if CC_TX_ON_CHANGE
+            if (CC_TX_MODE_ON_CHANGE == Entry->Mode)
+            {
+                assert(NULL != Entry->Shadow);
+
+                /* First check `Offset` ticks after LastTick; the elapsed heartbeat forces a transmission. */
+                CC_Sched_Add(&Instance->SendSched, i, Entry->LastTick, Phase);
+                Entry->LastTick = (CC_TIME_VAL_t)(Entry->LastTick - Entry->SendFreq);
+                continue;
+            }
+#endif
+            /* Backdate the last transmission so the first one falls `Offset` ticks after LastTick. */
+            if (0 != Phase)
+            {
+                Entry->LastTick = (CC_TIME_VAL_t)(Entry->LastTick - (Entry->SendFreq - Phase));
+            }
+            CC_Sched_Add(&Instance->SendSched, i, Entry->LastTick, Entry->SendFreq);
+        }
+    }
+}
+
+/**
+ * @brief Spreads the cyclic messages of a TX table evenly across their periods.
+ *
+ * Each bin spans `1 / CC_TX_PHASE_BINS` of the shortest period and accumulates the
+ * average number of frames per shortest period it carries, so a message sent every
+ * fourth shortest period weighs a quarter of one sent every shortest period. Periods
+ * are visited in ascending order without reordering the table.
+ *
+ * @param[in,out] TxTable Pointer to the TX message registration table.
+ * @param[in] TableSize Number of entries in the TxTable.
+ */
+void CC_TX_AutoPhase(CC_TX_table_t *TxTable, uint16_t TableSize)
+{
+    assert((NULL != TxTable) || (0 == TableSize));
+
+    uint32_t Load[CC_TX_PHASE_BINS] = {0};
+    CC_TIME_VAL_t MinPeriod = 0;
+
+    for (uint16_t i = 0; i < TableSize; i++)
+    {
+        TxTable[i].Offset = 0;
+        if ((0 != TxTable[i].SendFreq) && ((0 == MinPeriod) || (TxTable[i].SendFreq < MinPeriod)))
+        {
+            MinPeriod = TxTable[i].SendFreq;
+        }
+    }
+    if (0 == MinPeriod)
+    {
+        return;
+    }
+
+    uint16_t Bins = (MinPeriod < CC_TX_PHASE_BINS) ? (uint16_t)MinPeriod : (uint16_t)CC_TX_PHASE_BINS;
+    CC_TIME_VAL_t Width = (CC_TIME_VAL_t)(MinPeriod / Bins);
+    CC_TIME_VAL_t Period = 0;
+
+    for (;;)
+    {
+        CC_TIME_VAL_t Next = 0;
+
+        for (uint16_t i = 0; i < TableSize; i++)
+        {
+            CC_TIME_VAL_t SendFreq = TxTable[i].SendFreq;
+            if ((SendFreq > Period) && ((0 == Next) || (SendFreq < Next)))
+            {
+                Next = SendFreq;
+            }
+        }
+        if (0 == Next)
+        {
+            break;
+        }
+        Period = Next;
+
+        uint32_t Weight = (uint32_t)(((uint64_t)MinPeriod << 16) / Period);
+        if (0 == Weight)
+        {
+            Weight = 1;
+        }
+
+        for (uint16_t i = 0; i < TableSize; i++)
+        {
+            if (TxTable[i].SendFreq != Period)
+            {
+                continue;
+            }
+
+            uint16_t Best = 0;
+            for (uint16_t b = 1; b < Bins; b++)
+            {
+                if (Load[b] < Load[Best])
+                {
+                    Best = b;
+                }
+            }
+            Load[Best] += Weight;
+            TxTable[i].Offset = (CC_TIME_VAL_t)(Best * Width);
+        }
+    }
+}
+
+/**
+ * @brief Registers the multi-mailbox callbacks of a CAN TX instance.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] FreeSlots Callback function returning the number of free hardware TX slots.
+ * @param[in] SendBatch Callback function sending several messages at once, or NULL.
+ */
+void CC_TX_Batch_init(CC_TX_instance_t *Instance, uint16_t (*FreeSlots)(const CC_TX_instance_t *Instance),
+                      uint16_t (*SendBatch)(const CC_TX_instance_t *Instance, const CC_TX_message_t *Msgs,
+                                            uint16_t Count))
+{
+    assert(NULL != Instance);
+
+    Instance->FreeSlots = FreeSlots;
+    Instance->SendBatch = SendBatch;
+}
+
+/**
+ * @brief Registers the wakeup callback of a TX instance.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] Wake Pointer to the wakeup callback, or NULL.
+ */
+void CC_TX_Notify_init(CC_TX_instance_t *Instance, void (*Wake)(CC_TX_instance_t *Instance))
+{
+    assert(NULL != Instance);
+
+    Instance->WakeCallback = Wake;
+}
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Registers the payload storage of a CAN RX instance.
+ *
+ * Points the payload of every buffer slot into its own `PayloadSize` bytes of the storage.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in] Payload Pointer to at least `BufSize * PayloadSize` bytes of storage.
+ * @param[in] PayloadSize Payload bytes per slot (8-64).
+ */
+void CC_RX_FD_init(CC_RX_instance_t *Instance, uint8_t *Payload, uint8_t PayloadSize)
+{
+    assert((NULL != Instance) && (NULL != Payload) && (PayloadSize >= 8) && (PayloadSize <= CC_MAX_DATA_LEN));
+
+    for (uint16_t i = 0; i < Instance->Ring.Size; i++)
+    {
+        Instance->Buf[i].Data = &Payload[(size_t)i * PayloadSize];
+    }
+    Instance->PayloadSize = PayloadSize;
+}
+
+/**
+ * @brief Registers the payload storage of a CAN TX instance.
+ *
+ * Points the payload of every buffer slot into its own `PayloadSize` bytes of the storage.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] Payload Pointer to at least `BufSize * PayloadSize` bytes of storage.
+ * @param[in] PayloadSize Payload bytes per slot (8-64).
+ */
+void CC_TX_FD_init(CC_TX_instance_t *Instance, uint8_t *Payload, uint8_t PayloadSize)
+{
+    assert((NULL != Instance) && (NULL != Payload) && (PayloadSize >= 8) && (PayloadSize <= CC_MAX_DATA_LEN));
+
+    for (uint16_t i = 0; i < Instance->Ring.Size; i++)
+    {
+        Instance->Buf[i].Data = &Payload[(size_t)i * PayloadSize];
+    }
+    Instance->PayloadSize = PayloadSize;
+}
+#endif
+
+/**
+ * @brief Copies a buffer of bytes from source to destination.
+ *
+ * This function copies `size` bytes from the memory area pointed to by `src`
+ * to the memory area pointed to by `dst`. The `restrict` qualifier indicates
+ * that the source and destination buffers do not overlap. The copy method
+ * is selected by CC_COPY_MODE; with CC_COPY_WORDS, word-aligned buffers are
+ * moved 32 bits at a time, so a classic 8-byte payload takes two word moves.
+ *
+ * @param[in] src Pointer to the source buffer.
+ * @param[out] dst Pointer to the destination buffer.
+ * @param[in] size Number of bytes to copy.
+ */
+static inline void CopyBuf(const uint8_t *restrict src, uint8_t *restrict dst, size_t size)
+{
+    assert((src != NULL) && (dst != NULL));
+
+#if CC_COPY_MODE == CC_COPY_MEMCPY
+    memcpy(dst, src, size);
+#else
+#if CC_COPY_MODE == CC_COPY_WORDS
+    if (0u == (((uintptr_t)src | (uintptr_t)dst) & (sizeof(uint32_t) - 1u)))
+    {
+        for (; size >= sizeof(uint32_t); size -= sizeof(uint32_t))
+        {
+#if defined(__GNUC__)
+            *(CC_word_t *)(void *)dst = *(const CC_word_t *)(const void *)src;
+#else
+            memcpy(dst, src, sizeof(uint32_t));
+#endif
+            src += sizeof(uint32_t);
+            dst += sizeof(uint32_t);
+        }
+    }
+#endif
+    for (size_t i = 0; i < size; i++)
+    {
+        dst[i] = src[i];
+    }
+#endif
+}
+
+#if CC_TRACE
+/**
+ * @brief Helper function to write one frame to a trace ring.
+ *
+ * @param[in,out] Trace Pointer to the trace ring.
+ * @param[in] ID CAN message identifier.
+ * @param[in] Data Pointer to the payload.
+ * @param[in] DLC Data length code (0-15).
+ * @param[in] Flags Combination of the CC_TRACE_* record flags.
+ * @param[in] Time Timestamp of the frame.
+ */
+static void CC_Trace_Write(CC_trace_t *Trace, uint32_t ID, const uint8_t *Data, uint8_t DLC, uint8_t Flags,
+                           uint64_t Time)
+{
+    uint16_t Idx;
+
+    if (0 == CC_Ring_Reserve(&Trace->Ring, &Idx))
+    {
+        Trace->Dropped++;
+        return;
+    }
+
+    CC_trace_record_t *Rec = &Trace->Buf[Idx];
+    uint8_t Len = CC_DlcToLen(DLC, (uint8_t)(0 != (Flags & CC_TRACE_FDF)));
+
+    Rec->Time = Time;
+    Rec->ID = ID;
+    Rec->DLC = DLC;
+    Rec->Flags = Flags;
+    Rec->Channel = Trace->Channel;
+    Rec->Reserved = 0;
+    if (Len > 0)
+    {
+        CopyBuf(Data, Rec->Data, Len);
+    }
+    CC_Ring_Commit(&Trace->Ring);
+}
+
+/**
+ * @brief Helper function to capture a frame pushed into an RX instance.
+ *
+ * @param[in,out] Trace Pointer to the trace ring.
+ * @param[in] Msg Pointer to the frame; its payload is taken from `Data`.
+ * @param[in] Data Pointer to the payload.
+ * @param[in] Time System tick of the frame (ignored with CC_RX_HW_TIMESTAMP).
+ */
+static inline void CC_Trace_Rx(CC_trace_t *Trace, const CC_RX_message_t *Msg, const uint8_t *Data,
+                               CC_TIME_VAL_t Time)
+{
+    uint8_t Flags = Msg->IDE_flag ? CC_TRACE_IDE : 0u;
+
+#if CC_FD_SUPPORT
+    Flags |= (Msg->FDF_flag ? CC_TRACE_FDF : 0u) | (Msg->BRS_flag ? CC_TRACE_BRS : 0u) |
+             (Msg->ESI_flag ? CC_TRACE_ESI : 0u);
+#endif
+#if CC_RX_HW_TIMESTAMP
+    (void)Time;
+    CC_Trace_Write(Trace, Msg->ID, Data, Msg->DLC, (uint8_t)(Flags | CC_TRACE_HWTIME), Msg->HwTime);
+#else
+    CC_Trace_Write(Trace, Msg->ID, Data, Msg->DLC, Flags, Time);
+#endif
+}
+
+/**
+ * @brief Helper function to capture frames accepted by the TX driver.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] Msgs Pointer to the sent frames.
+ * @param[in] Count Number of sent frames.
+ * @param[in] Now Current tick of the instance.
+ */
+static inline void CC_Trace_Tx(CC_TX_instance_t *Instance, const CC_TX_message_t *Msgs, uint16_t Count,
+                               CC_TIME_VAL_t Now)
+{
+    if (NULL == Instance->Trace)
+    {
+        return;
+    }
+
+    for (uint16_t i = 0; i < Count; i++)
+    {
+        uint8_t Flags = (uint8_t)(CC_TRACE_TX | (Msgs[i].IDE_flag ? CC_TRACE_IDE : 0u));
+
+#if CC_FD_SUPPORT
+        Flags |= (Msgs[i].FDF_flag ? CC_TRACE_FDF : 0u) | (Msgs[i].BRS_flag ? CC_TRACE_BRS : 0u);
+#endif
+        CC_Trace_Write(Instance->Trace, Msgs[i].ID, Msgs[i].Data, Msgs[i].DLC, Flags, Now);
+    }
+}
+#endif
+
+/**
+ * @brief Helper function to get the lookup key at a position of the lookup index.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[in] Pos Position in key order.
+ * @return uint32_t Lookup key.
+ */
+static inline uint32_t CC_RX_KeyAt(const CC_RX_instance_t *Instance, uint16_t Pos)
+{
+    if (NULL != Instance->Keys)
+    {
+        return Instance->Keys[Pos];
+    }
+
+    const CC_RX_table_t *Entry = &Instance->RxTable[Instance->RxTable[Pos].LookupIdx];
+    return CC_RX_Key(Entry->ID, Entry->IDE_flag);
+}
+
+/**
+ * @brief Helper function to get the table entry at a position of the lookup index.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[in] Pos Position in key order.
+ * @return CC_RX_table_t* Pointer to the table entry.
+ */
+static inline CC_RX_table_t *CC_RX_EntryAt(const CC_RX_instance_t *Instance, uint16_t Pos)
+{
+    uint16_t Idx = (NULL != Instance->KeyIdx) ? Instance->KeyIdx[Pos] : Instance->RxTable[Pos].LookupIdx;
+
+    return &Instance->RxTable[Idx];
+}
+
+#if CC_RX_SIMD
+/**
+ * @brief Counts the keys smaller than a given key in a block of sorted keys.
+ *
+ * SSE2 and AVX2 only compare signed lanes, so both sides are biased by the sign bit
+ * to get the unsigned order. Each lane accumulates the all-ones compare results.
+ *
+ * @param[in] Keys Pointer to the first key of the block.
+ * @param[in] Count Number of keys in the block.
+ * @param[in] Key Key to compare against.
+ * @return uint16_t Number of keys smaller than Key.
+ */
+static inline uint16_t CC_RX_CountBelow(const uint32_t *Keys, uint16_t Count, uint32_t Key)
+{
+    uint16_t i = 0;
+    uint32_t Below = 0;
+
+#if defined(__AVX2__)
+    const __m256i Bias = _mm256_set1_epi32(INT32_MIN);
+    const __m256i Needle = _mm256_xor_si256(_mm256_set1_epi32((int32_t)Key), Bias);
+    __m256i Acc = _mm256_setzero_si256();
+
+    for (; (uint16_t)(i + 8u) <= Count; i += 8u)
+    {
+        __m256i Block = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(const void *)&Keys[i]), Bias);
+        Acc = _mm256_sub_epi32(Acc, _mm256_cmpgt_epi32(Needle, Block));
+    }
+
+    __m128i Half = _mm_add_epi32(_mm256_castsi256_si128(Acc), _mm256_extracti128_si256(Acc, 1));
+    Half = _mm_add_epi32(Half, _mm_shuffle_epi32(Half, _MM_SHUFFLE(1, 0, 3, 2)));
+    Half = _mm_add_epi32(Half, _mm_shuffle_epi32(Half, _MM_SHUFFLE(2, 3, 0, 1)));
+    Below = (uint32_t)_mm_cvtsi128_si32(Half);
+#elif defined(__SSE2__)
+    const __m128i Bias = _mm_set1_epi32(INT32_MIN);
+    const __m128i Needle = _mm_xor_si128(_mm_set1_epi32((int32_t)Key), Bias);
+    __m128i Acc = _mm_setzero_si128();
+
+    for (; (uint16_t)(i + 4u) <= Count; i += 4u)
+    {
+        __m128i Block = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(const void *)&Keys[i]), Bias);
+        Acc = _mm_sub_epi32(Acc, _mm_cmpgt_epi32(Needle, Block));
+    }
+
+    Acc = _mm_add_epi32(Acc, _mm_shuffle_epi32(Acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    Acc = _mm_add_epi32(Acc, _mm_shuffle_epi32(Acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    Below = (uint32_t)_mm_cvtsi128_si32(Acc);
+#elif defined(__ARM_NEON)
+    const uint32x4_t Needle = vdupq_n_u32(Key);
+    uint32x4_t Acc = vdupq_n_u32(0);
+
+    for (; (uint16_t)(i + 4u) <= Count; i += 4u)
+    {
+        Acc = vsubq_u32(Acc, vcltq_u32(vld1q_u32(&Keys[i]), Needle));
+    }
+
+    uint32x2_t Pair = vadd_u32(vget_low_u32(Acc), vget_high_u32(Acc));
+    Below = vget_lane_u32(vpadd_u32(Pair, Pair), 0);
+#endif
+
+    for (; i < Count; i++)
+    {
+        Below += (Keys[i] < Key) ? 1u : 0u;
+    }
+    return (uint16_t)Below;
+}
+#endif
+
+/**
+ * @brief Helper function to find the first position of a key in the lookup index.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[in] Key Lookup key.
+ * @return uint16_t Position of the first key not smaller than Key, or TableSize.
+ */
+static inline uint16_t CC_RX_LowerBound(const CC_RX_instance_t *Instance, uint32_t Key)
+{
+    uint16_t Low = 0;
+    uint16_t High = Instance->TableSize;
+
+#if CC_RX_SIMD
+    if (NULL != Instance->Keys)
+    {
+        const uint32_t *Keys = Instance->Keys;
+
+        while ((uint16_t)(High - Low) > CC_RX_SIMD_BLOCK)
+        {
+            uint16_t Mid = Low + ((High - Low) >> 1);
+
+            if (Keys[Mid] < Key)
+            {
+                Low = Mid + 1;
+            }
+            else
+            {
+                High = Mid;
+            }
+        }
+        return (uint16_t)(Low + CC_RX_CountBelow(&Keys[Low], (uint16_t)(High - Low), Key));
+    }
+#endif
+
+    while (Low < High)
+    {
+        uint16_t Mid = Low + ((High - Low) >> 1);
+
+        if (CC_RX_KeyAt(Instance, Mid) < Key)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+    return Low;
+}
+
+/**
+ * @brief Helper function to find the RX table entry matching a received frame.
+ *
+ * Searches the lookup index for the first entry with the frame's (IDE, ID) key,
+ * then walks the entries sharing that key for a DLC (and, with CC_FD_SUPPORT,
+ * FDF) match.
+ * This keeps the first-match-in-table-order semantics of a linear scan.
+ * If CC_RX_Keys_init attached dense key arrays, the search only touches them and
+ * table entries are loaded for key matches only.
+ *
+ * @param[in] Instance Pointer to the RX instance containing the RX table.
+ * @param[in] ID CAN message identifier.
+ * @param[in] IDE_flag Identifier extension flag.
+ * @param[in] DLC Data length code (0-15).
+ * @param[in] FDF_flag FD format flag (ignored without CC_FD_SUPPORT).
+ * @return CC_RX_table_t* Pointer to the matching entry, or NULL if the frame is not registered.
+ */
+static inline CC_RX_table_t *CC_RX_Lookup(const CC_RX_instance_t *Instance, uint32_t ID, uint8_t IDE_flag,
+                                          uint8_t DLC, uint8_t FDF_flag)
+{
+    uint32_t Key = CC_RX_Key(ID, IDE_flag);
+
+#if !CC_FD_SUPPORT
+    (void)FDF_flag;
+#endif
+
+    for (uint16_t Pos = CC_RX_LowerBound(Instance, Key);
+         (Pos < Instance->TableSize) && (CC_RX_KeyAt(Instance, Pos) == Key); Pos++)
+    {
+        CC_RX_table_t *Entry = CC_RX_EntryAt(Instance, Pos);
+
+#if CC_FD_SUPPORT
+        if ((Entry->DLC == DLC) && (Entry->FDF_flag == FDF_flag))
+#else
+        if (Entry->DLC == DLC)
+#endif
+        {
+            return Entry;
+        }
+    }
+    return NULL;
+}
+
+#if CC_TX_PRIORITY_QUEUE
+/**
+ * @brief Computes the arbitration order key of a CAN frame.
+ *
+ * Mirrors the bit order of CAN arbitration: 11-bit base ID, then the IDE bit,
+ * then the 18-bit ID extension. A lower key wins arbitration.
+ *
+ * @param[in] Msg Pointer to the message.
+ * @return uint32_t Arbitration key.
+ */
+static inline uint32_t CC_TX_ArbKey(const CC_TX_message_t *Msg)
+{
+    if (Msg->IDE_flag)
+    {
+        return (((Msg->ID >> 18) & 0x7FFu) << 19) | (1u << 18) | (Msg->ID & 0x3FFFFu);
+    }
+    return (Msg->ID & 0x7FFu) << 19;
+}
+
+/**
+ * @brief Checks whether a queued message must be sent before another one.
+ *
+ * @param[in] A Pointer to the first message.
+ * @param[in] B Pointer to the second message.
+ * @return uint8_t 1 if A goes out before B, otherwise 0.
+ */
+static inline uint8_t CC_TX_Before(const CC_TX_message_t *A, const CC_TX_message_t *B)
+{
+    uint32_t KeyA = CC_TX_ArbKey(A);
+    uint32_t KeyB = CC_TX_ArbKey(B);
+
+    return (KeyA < KeyB) || ((KeyA == KeyB) && ((int16_t)(uint16_t)(A->Seq - B->Seq) < 0));
+}
+#endif
+
+/**
+ * @brief Helper function to get a free slot of the TX instance buffer.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @return CC_TX_message_t* Pointer to the free slot, or NULL if the buffer is full.
+ */
+static inline CC_TX_message_t *CC_TX_Acquire(CC_TX_instance_t *Instance)
+{
+#if CC_TX_PRIORITY_QUEUE
+    if (Instance->Count >= Instance->Ring.Size)
+    {
+#if CC_STATS_ENABLE
+        Instance->Stats.DroppedFull++;
+#endif
+        return NULL;
+    }
+
+#if CC_STATS_ENABLE
+    if (Instance->Count + 1u > Instance->Stats.HighWater)
+    {
+        Instance->Stats.HighWater = Instance->Count + 1u;
+    }
+#endif
+    CC_TX_message_t *Slot = &Instance->Buf[Instance->Count];
+#else
+    uint16_t Idx;
+    uint16_t Free = CC_Ring_Reserve(&Instance->Ring, &Idx);
+
+    if (0 == Free)
+    {
+#if CC_STATS_ENABLE
+        Instance->Stats.DroppedFull++;
+#endif
+        return NULL;
+    }
+
+#if CC_STATS_ENABLE
+    uint16_t Level = (uint16_t)(Instance->Ring.Size - Free);
+    if (Level > Instance->Stats.HighWater)
+    {
+        Instance->Stats.HighWater = Level;
+    }
+#endif
+    CC_TX_message_t *Slot = &Instance->Buf[Idx];
+#endif
+#if CC_LATENCY
+    Slot->Stamp = CC_Cycles();
+#endif
+    return Slot;
+}
+
+/**
+ * @brief Helper function to queue the slot returned by the last CC_TX_Acquire call.
+ *
+ * In priority mode the message is sifted up to its place in the heap; slots are
+ * moved as whole structures, so each message keeps its own payload storage.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ */
+static inline void CC_TX_Publish(CC_TX_instance_t *Instance)
+{
+#if CC_STATS_ENABLE
+    Instance->Stats.Pushed++;
+#endif
+#if CC_TX_PRIORITY_QUEUE
+    uint16_t Pos = Instance->Count;
+    CC_TX_message_t Msg = Instance->Buf[Pos];
+
+    Msg.Seq = Instance->Seq++;
+    while (Pos > 0)
+    {
+        uint16_t Parent = (uint16_t)((Pos - 1u) / 2u);
+        if (!CC_TX_Before(&Msg, &Instance->Buf[Parent]))
+        {
+            break;
+        }
+        Instance->Buf[Pos] = Instance->Buf[Parent];
+        Pos = Parent;
+    }
+    Instance->Buf[Pos] = Msg;
+    Instance->Count++;
+
+    uint16_t Level = Instance->Count;
+#else
+    CC_Ring_Commit(&Instance->Ring);
+
+    uint16_t Level = (uint16_t)(Instance->Ring.Size - 1u - CC_Ring_Free(&Instance->Ring));
+#endif
+    if ((1u == Level) && (NULL != Instance->WakeCallback))
+    {
+        Instance->WakeCallback(Instance);
+    }
+}
+
+/**
+ * @brief Helper function to flag an RX instance as ready in its bus group.
+ *
+ * @param[in] Instance Pointer to the RX instance that received messages.
+ */
+static inline void CC_RX_Notify(CC_RX_instance_t *Instance)
+{
+#if CC_SYNC_MODE == CC_SYNC_C11
+    if (NULL != Instance->Group)
+    {
+        atomic_fetch_or_explicit(&Instance->Group->Ready, Instance->GroupBit, memory_order_release);
+    }
+#else
+    (void)Instance;
+#endif
+}
+
+/**
+ * @brief Helper function to fire the wakeup callbacks after frames were queued.
+ *
+ * The fill level is read after the frames were published, so a consumer that found
+ * the buffer empty just before is always woken; a consumer draining concurrently may
+ * get a spurious wakeup.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in] Added Number of frames just published.
+ */
+static inline void CC_RX_Wake(CC_RX_instance_t *Instance, uint16_t Added)
+{
+    if ((NULL == Instance->WakeCallback) && (NULL == Instance->HighWaterCallback))
+    {
+        return;
+    }
+
+    uint16_t Level = (uint16_t)(Instance->Ring.Size - 1u - CC_Ring_Free(&Instance->Ring));
+
+    if ((Level == Added) && (NULL != Instance->WakeCallback))
+    {
+        Instance->WakeCallback(Instance);
+    }
+    if ((NULL != Instance->HighWaterCallback) && (Level >= Instance->HighWaterLevel) &&
+        (Level < Instance->HighWaterLevel + Added))
+    {
+        Instance->HighWaterCallback(Instance, Level);
+    }
+}
+
+/**
+ * @brief Helper function to read the FD format flag of a received message.
+ *
+ * @param[in] Msg Pointer to the message.
+ * @return uint8_t FD format flag, always 0 without CC_FD_SUPPORT.
+ */
+static inline uint8_t CC_RX_MsgFdf(const CC_RX_message_t *Msg)
+{
+#if CC_FD_SUPPORT
+    return Msg->FDF_flag;
+#else
+    (void)Msg;
+    return 0;
+#endif
+}
+
+/**
+ * @brief Helper function to copy a received message, except for its `Time` field.
+ *
+ * @param[out] Dst Pointer to the destination message.
+ * @param[in] Src Pointer to the source message.
+ * @param[in] Len Number of payload bytes to copy.
+ */
+static inline void CC_RX_MsgCopy(CC_RX_message_t *Dst, const CC_RX_message_t *Src, uint8_t Len)
+{
+    Dst->ID = Src->ID;
+    Dst->DLC = Src->DLC;
+    Dst->IDE_flag = Src->IDE_flag;
+#if CC_FD_SUPPORT
+    Dst->FDF_flag = Src->FDF_flag;
+    Dst->BRS_flag = Src->BRS_flag;
+    Dst->ESI_flag = Src->ESI_flag;
+#endif
+#if CC_RX_HW_TIMESTAMP
+    Dst->HwTime = Src->HwTime;
+#endif
+
+    if (Len > 0)
+    {
+        CopyBuf(Src->Data, Dst->Data, Len);
+    }
+}
+
+#if CC_GATEWAY
+/**
+ * @brief Helper function to forward a received frame along its matching routes.
+ *
+ * Each matching route gets its own copy, written directly into a slot of the
+ * destination buffer, rewritten and transformed in place, and then queued.
+ * A route whose destination is full drops its copy.
+ *
+ * @param[in,out] Instance Pointer to the source RX instance.
+ * @param[in] Msg Pointer to the frame; its `Data` and time fields are not used.
+ * @param[in] Data Pointer to the payload of the frame.
+ * @param[in] Isr CC_ROUTE_ISR to apply the push-time routes, 0 for the poll-time routes.
+ * @return uint8_t Non-zero if a matching route consumes the frame.
+ */
+static uint8_t CC_RX_Route(CC_RX_instance_t *Instance, const CC_RX_message_t *Msg, const uint8_t *Data, uint8_t Isr)
+{
+    uint8_t Len = CC_DlcToLen(Msg->DLC, CC_RX_MsgFdf(Msg));
+    uint8_t Consumed = 0;
+#if CC_STATS_ENABLE
+    uint8_t Routed = 0;
+#endif
+
+    for (uint16_t i = 0; i < Instance->RouteCount; i++)
+    {
+        const CC_route_t *Route = &Instance->Routes[i];
+
+        if (((Route->Flags & CC_ROUTE_ISR) != Isr) || (Route->IDE_flag != Msg->IDE_flag) ||
+            ((Msg->ID & Route->Mask) != Route->ID))
+        {
+            continue;
+        }
+
+#if CC_STATS_ENABLE
+        Routed = 1;
+#endif
+        Consumed |= (uint8_t)(Route->Flags & CC_ROUTE_CONSUME);
+
+        CC_TX_instance_t *Dest = Route->Dest;
+
+#if CC_FD_SUPPORT
+        if (Len > Dest->PayloadSize)
+        {
+#if CC_STATS_ENABLE
+            Dest->Stats.DroppedOversize++;
+#endif
+            continue;
+        }
+#endif
+
+        CC_TX_message_t *Slot = CC_TX_Acquire(Dest);
+
+        if (NULL == Slot)
+        {
+            continue;
+        }
+
+        Slot->ID = (Msg->ID & ~Route->RewriteMask) | (Route->RewriteID & Route->RewriteMask);
+        Slot->DLC = Msg->DLC;
+        Slot->IDE_flag = Msg->IDE_flag;
+#if CC_FD_SUPPORT
+        Slot->FDF_flag = Msg->FDF_flag;
+        Slot->BRS_flag = Msg->BRS_flag;
+#endif
+
+        if (Len > 0)
+        {
+            CopyBuf(Data, Slot->Data, Len);
+        }
+
+        if ((NULL == Route->Transform) || Route->Transform(Route, Slot))
+        {
+            CC_TX_Publish(Dest);
+        }
+    }
+
+#if CC_STATS_ENABLE
+    Instance->Stats.Routed += Routed;
+#endif
+    return Consumed;
+}
+#endif
+
+#if CC_RX_MAILBOX
+/**
+ * @brief Helper function to find the CC_RX_MODE_LATEST entry a received frame belongs to.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[in] ID CAN message identifier.
+ * @param[in] IDE_flag Identifier extension flag.
+ * @param[in] DLC Data length code (0-15).
+ * @param[in] FDF_flag FD format flag (ignored without CC_FD_SUPPORT).
+ * @return CC_RX_table_t* Pointer to the mailbox entry, or NULL if the frame is to be queued.
+ */
+static inline CC_RX_table_t *CC_RX_MailboxFind(const CC_RX_instance_t *Instance, uint32_t ID, uint8_t IDE_flag,
+                                               uint8_t DLC, uint8_t FDF_flag)
+{
+    if (0 == Instance->MailboxCount)
+    {
+        return NULL;
+    }
+
+    CC_RX_table_t *Entry = CC_RX_Lookup(Instance, ID, IDE_flag, DLC, FDF_flag);
+
+    return ((NULL != Entry) && (CC_RX_MODE_LATEST == Entry->Mode)) ? Entry : NULL;
+}
+
+/**
+ * @brief Helper function to advance a dirty mailbox queue position.
+ *
+ * Positions run over twice the queue size, so a full queue differs from an empty one.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[in] Pos Queue position.
+ * @return uint16_t Next queue position.
+ */
+static inline uint16_t CC_RX_MailboxNext(const CC_RX_instance_t *Instance, uint16_t Pos)
+{
+    Pos++;
+    return (Pos == 2u * Instance->MailboxCount) ? 0u : Pos;
+}
+
+/**
+ * @brief Helper function to get the table entry holding a dirty mailbox queue slot.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[in] Pos Queue position.
+ * @return CC_RX_table_t* Pointer to the table entry whose MailboxIdx holds the slot.
+ */
+static inline CC_RX_table_t *CC_RX_MailboxQueueAt(const CC_RX_instance_t *Instance, uint16_t Pos)
+{
+    return &Instance->RxTable[(Pos >= Instance->MailboxCount) ? (Pos - Instance->MailboxCount) : Pos];
+}
+
+/**
+ * @brief Helper function to open the mailbox of an entry for writing.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in,out] Entry Pointer to the mailbox entry.
+ * @return CC_RX_message_t* Pointer to the mailbox message, to be filled before CC_RX_MailboxEnd.
+ */
+static inline CC_RX_message_t *CC_RX_MailboxBegin(CC_RX_instance_t *Instance, CC_RX_table_t *Entry)
+{
+    CC_RX_mailbox_t *Mailbox = Entry->Mailbox;
+    uint16_t Seq = CC_Index_Load(&Mailbox->Seq);
+
+#if CC_STATS_ENABLE
+    if (Seq != CC_Index_Load(&Mailbox->Read))
+    {
+        Instance->Stats.Overwritten++;
+    }
+#else
+    (void)Instance;
+#endif
+    CC_Seq_WriteBegin(&Mailbox->Seq, (uint16_t)(Seq + 1u));
+    return &Mailbox->Msg;
+}
+
+/**
+ * @brief Helper function to publish the mailbox opened by CC_RX_MailboxBegin.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in,out] Entry Pointer to the mailbox entry.
+ */
+static inline void CC_RX_MailboxEnd(CC_RX_instance_t *Instance, CC_RX_table_t *Entry)
+{
+    CC_RX_mailbox_t *Mailbox = Entry->Mailbox;
+    uint16_t Posted = CC_Index_Load(&Mailbox->Posted);
+
+    CC_Index_Release(&Mailbox->Seq, (uint16_t)(CC_Index_Load(&Mailbox->Seq) + 1u));
+    CC_Fence_Full();
+
+    /* A mailbox still queued is parsed with this message. */
+    if (Posted != CC_Index_Acquire(&Mailbox->Drained))
+    {
+        return;
+    }
+
+    uint16_t Head = CC_Index_Load(&Instance->MailboxHead);
+
+    CC_RX_MailboxQueueAt(Instance, Head)->MailboxIdx = (uint16_t)(Entry - Instance->RxTable);
+    CC_Index_Release(&Mailbox->Posted, (uint16_t)(Posted + 1u));
+    CC_Index_Release(&Instance->MailboxHead, CC_RX_MailboxNext(Instance, Head));
+    CC_RX_Notify(Instance);
+
+    if ((NULL != Instance->WakeCallback) && (Head == CC_Index_Acquire(&Instance->MailboxTail)))
+    {
+        Instance->WakeCallback(Instance);
+    }
+}
+
+/**
+ * @brief Helper function to take the unparsed message of a mailbox.
+ *
+ * Copies the message and retries if the producer wrote the mailbox meanwhile.
+ *
+ * @param[in,out] Entry Pointer to the mailbox entry.
+ * @param[out] Msg Pointer to the message receiving the copy.
+ * @return uint8_t Non-zero if a message was taken, 0 if the mailbox held no new message.
+ */
+static inline uint8_t CC_RX_MailboxTake(CC_RX_table_t *Entry, CC_RX_message_t *Msg)
+{
+    CC_RX_mailbox_t *Mailbox = Entry->Mailbox;
+#if CC_FD_SUPPORT
+    uint8_t Len = CC_DlcToLen(Entry->DLC, Entry->FDF_flag);
+#else
+    uint8_t Len = CC_DlcToLen(Entry->DLC, 0);
+#endif
+
+    for (;;)
+    {
+        uint16_t Seq = CC_Index_Acquire(&Mailbox->Seq);
+
+        if (Seq == CC_Index_Load(&Mailbox->Read))
+        {
+            return 0;
+        }
+
+        CC_RX_MsgCopy(Msg, &Mailbox->Msg, Len);
+        Msg->Time = Mailbox->Msg.Time;
+
+        if (!CC_Seq_ReadRetry(&Mailbox->Seq, Seq))
+        {
+            CC_Index_Release(&Mailbox->Read, Seq);
+            return 1;
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Reserves the next free slot of the RX instance buffer.
+ *
+ * The returned slot is not visible to the consumer until CC_RX_Commit is called.
+ * Its `Time` field is preset to the current system tick and may be overwritten.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @return CC_RX_message_t* Pointer to the reserved slot, or NULL if the buffer is full.
+ */
+CC_RX_message_t *CC_RX_Reserve(CC_RX_instance_t *Instance)
+{
+    assert(Instance != NULL);
+
+    uint16_t Idx;
+    uint16_t Free = CC_Ring_Reserve(&Instance->Ring, &Idx);
+
+    if (0 == Free)
+    {
+#if CC_STATS_ENABLE
+        Instance->Stats.DroppedFull++;
+#endif
+        return NULL;
+    }
+
+#if CC_STATS_ENABLE
+    uint16_t Level = (uint16_t)(Instance->Ring.Size - Free);
+    if (Level > Instance->Stats.HighWater)
+    {
+        Instance->Stats.HighWater = Level;
+    }
+#endif
+
+    CC_RX_message_t *Slot = &Instance->Buf[Idx];
+    Slot->Time = CC_INSTANCE_TICK(Instance);
+#if CC_LATENCY
+    Slot->Stamp = CC_Cycles();
+#endif
+    return Slot;
+}
+
+/**
+ * @brief Helper function to publish the reserved slot of the RX instance buffer.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ */
+static inline void CC_RX_Publish(CC_RX_instance_t *Instance)
+{
+#if CC_STATS_ENABLE
+    Instance->Stats.Pushed++;
+#endif
+    CC_Ring_Commit(&Instance->Ring);
+    CC_RX_Notify(Instance);
+    CC_RX_Wake(Instance, 1);
+}
+
+/**
+ * @brief Publishes the slot returned by the last successful CC_RX_Reserve call.
+ *
+ * With CC_RX_MAILBOX, a frame of a CC_RX_MODE_LATEST entry is moved to the entry's
+ * mailbox and the slot stays free.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ */
+void CC_RX_Commit(CC_RX_instance_t *Instance)
+{
+    assert(Instance != NULL);
+
+#if CC_GATEWAY || CC_RX_MAILBOX || CC_TRACE
+    CC_RX_message_t *Slot = &Instance->Buf[CC_Ring_Next(&Instance->Ring, CC_Index_Load(&Instance->Ring.Head))];
+#endif
+
+#if CC_TRACE
+    if (NULL != Instance->Trace)
+    {
+        CC_Trace_Rx(Instance->Trace, Slot, Slot->Data, Slot->Time);
+    }
+#endif
+
+#if CC_GATEWAY
+    if ((0 != Instance->RouteIsr) && CC_RX_Route(Instance, Slot, Slot->Data, CC_ROUTE_ISR))
+    {
+        return;
+    }
+#endif
+#if CC_RX_MAILBOX
+    CC_RX_table_t *Entry =
+        CC_RX_MailboxFind(Instance, Slot->ID, Slot->IDE_flag, Slot->DLC, CC_RX_MsgFdf(Slot));
+
+    if (NULL != Entry)
+    {
+        CC_RX_message_t *Box = CC_RX_MailboxBegin(Instance, Entry);
+
+        CC_RX_MsgCopy(Box, Slot, CC_DlcToLen(Slot->DLC, CC_RX_MsgFdf(Slot)));
+        Box->Time = Slot->Time;
+        CC_RX_MailboxEnd(Instance, Entry);
+        return;
+    }
+#endif
+
+    CC_RX_Publish(Instance);
+}
+
+/**
+ * @brief Helper function to copy a raw CAN frame into the RX instance buffer.
+ *
+ * @param[in,out] Instance Pointer to the RX instance where the message will be stored.
+ * @param[in] ID CAN message identifier.
+ * @param[in] Data Pointer to the data bytes of the CAN message.
+ * @param[in] DLC Data length code (0-15).
+ * @param[in] IDE_flag Identifier extension flag.
+ * @param[in] FDF_flag FD format flag (ignored without CC_FD_SUPPORT).
+ * @param[in] BRS_flag Bit rate switch flag (ignored without CC_FD_SUPPORT).
+ * @param[in] ESI_flag Error state indicator flag (ignored without CC_FD_SUPPORT).
+ * @param[in] HwTime Hardware timestamp (ignored without CC_RX_HW_TIMESTAMP).
+ */
+static inline void CC_RX_Store(CC_RX_instance_t *Instance, uint32_t ID, const uint8_t *Data, uint8_t DLC,
+                               uint8_t IDE_flag, uint8_t FDF_flag, uint8_t BRS_flag, uint8_t ESI_flag,
+                               uint64_t HwTime)
+{
+    uint8_t Len = CC_DlcToLen(DLC, FDF_flag);
+    CC_RX_message_t *Slot;
+
+#if !CC_FD_SUPPORT
+    (void)FDF_flag;
+    (void)BRS_flag;
+    (void)ESI_flag;
+#endif
+#if !CC_RX_HW_TIMESTAMP
+    (void)HwTime;
+#endif
+
+#if CC_TRACE
+    if (NULL != Instance->Trace)
+    {
+        uint8_t Flags = IDE_flag ? CC_TRACE_IDE : 0u;
+
+#if CC_FD_SUPPORT
+        Flags |= (FDF_flag ? CC_TRACE_FDF : 0u) | (BRS_flag ? CC_TRACE_BRS : 0u) | (ESI_flag ? CC_TRACE_ESI : 0u);
+#endif
+#if CC_RX_HW_TIMESTAMP
+        CC_Trace_Write(Instance->Trace, ID, Data, DLC, (uint8_t)(Flags | CC_TRACE_HWTIME), HwTime);
+#else
+        CC_Trace_Write(Instance->Trace, ID, Data, DLC, Flags, CC_INSTANCE_TICK(Instance));
+#endif
+    }
+#endif
+
+#if CC_GATEWAY
+    if (0 != Instance->RouteIsr)
+    {
+        CC_RX_message_t Frame;
+
+        Frame.ID = ID;
+        Frame.DLC = DLC;
+        Frame.IDE_flag = IDE_flag;
+#if CC_FD_SUPPORT
+        Frame.FDF_flag = FDF_flag;
+        Frame.BRS_flag = BRS_flag;
+#endif
+        if (CC_RX_Route(Instance, &Frame, Data, CC_ROUTE_ISR))
+        {
+            return;
+        }
+    }
+#endif
+
+#if CC_RX_MAILBOX
+    CC_RX_table_t *Entry = CC_RX_MailboxFind(Instance, ID, IDE_flag, DLC, FDF_flag);
+
+    if (NULL != Entry)
+    {
+        Slot = CC_RX_MailboxBegin(Instance, Entry);
+        Slot->Time = CC_INSTANCE_TICK(Instance);
+    }
+    else
+#endif
+    {
+#if CC_FD_SUPPORT
+        if (Len > Instance->PayloadSize)
+        {
+#if CC_STATS_ENABLE
+            Instance->Stats.DroppedOversize++;
+#endif
+            return;
+        }
+#endif
+        Slot = CC_RX_Reserve(Instance);
+
+        if (NULL == Slot)
+        {
+            return;
+        }
+    }
+
+    Slot->ID = ID;
+    Slot->DLC = DLC;
+    Slot->IDE_flag = IDE_flag;
+#if CC_FD_SUPPORT
+    Slot->FDF_flag = FDF_flag;
+    Slot->BRS_flag = BRS_flag;
+    Slot->ESI_flag = ESI_flag;
+#endif
+#if CC_RX_HW_TIMESTAMP
+    Slot->HwTime = HwTime;
+#endif
+
+    if (Len > 0)
+    {
+        CopyBuf(Data, Slot->Data, Len);
+    }
+
+#if CC_RX_MAILBOX
+    if (NULL != Entry)
+    {
+        CC_RX_MailboxEnd(Instance, Entry);
+        return;
+    }
+#endif
+    CC_RX_Publish(Instance);
+}
+
+/**
+ * @brief Pushes a raw CAN message into the RX instance buffer.
+ *
+ * This function should be called from lower-level CAN driver code when
+ * a new raw CAN frame is received. It copies the received frame data into
+ * the RX buffer of the provided instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance where the message will be stored.
+ * @param[in] ID CAN message identifier.
+ * @param[in] Data Pointer to the data bytes of the CAN message.
+ * @param[in] DLC Data length code (0-15, codes above 8 carry 8 bytes).
+ * @param[in] IDE_flag Identifier extension flag (0 for standard 11-bit ID, 1 for extended 29-bit ID).
+ */
+void CC_RX_PushMsg(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag)
+{
+    CC_RX_Store(Instance, ID, Data, DLC, IDE_flag, 0, 0, 0, 0);
+}
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Pushes a raw CAN FD message into the RX instance buffer.
+ *
+ * @param[in,out] Instance Pointer to the RX instance where the message will be stored.
+ * @param[in] ID CAN message identifier.
+ * @param[in] Data Pointer to the data bytes of the CAN message.
+ * @param[in] DLC Data length code (0-15).
+ * @param[in] IDE_flag Identifier extension flag (0 for standard 11-bit ID, 1 for extended 29-bit ID).
+ * @param[in] BRS_flag Bit rate switch flag.
+ * @param[in] ESI_flag Error state indicator flag.
+ */
+void CC_RX_PushMsgFD(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                     uint8_t BRS_flag, uint8_t ESI_flag)
+{
+    CC_RX_Store(Instance, ID, Data, DLC, IDE_flag, 1, BRS_flag, ESI_flag, 0);
+}
+#endif
+
+#if CC_RX_HW_TIMESTAMP
+/**
+ * @brief Pushes a raw CAN message with its hardware timestamp into the RX instance buffer.
+ *
+ * @param[in,out] Instance Pointer to the RX instance where the message will be stored.
+ * @param[in] ID CAN message identifier.
+ * @param[in] Data Pointer to the data bytes of the CAN message.
+ * @param[in] DLC Data length code (0-15, codes above 8 carry 8 bytes).
+ * @param[in] IDE_flag Identifier extension flag (0 for standard 11-bit ID, 1 for extended 29-bit ID).
+ * @param[in] HwTime Hardware timestamp of the message.
+ */
+void CC_RX_PushMsgTs(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                     uint64_t HwTime)
+{
+    CC_RX_Store(Instance, ID, Data, DLC, IDE_flag, 0, 0, 0, HwTime);
+}
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Pushes a raw CAN FD message with its hardware timestamp into the RX instance buffer.
+ *
+ * @param[in,out] Instance Pointer to the RX instance where the message will be stored.
+ * @param[in] ID CAN message identifier.
+ * @param[in] Data Pointer to the data bytes of the CAN message.
+ * @param[in] DLC Data length code (0-15).
+ * @param[in] IDE_flag Identifier extension flag (0 for standard 11-bit ID, 1 for extended 29-bit ID).
+ * @param[in] BRS_flag Bit rate switch flag.
+ * @param[in] ESI_flag Error state indicator flag.
+ * @param[in] HwTime Hardware timestamp of the message.
+ */
+void CC_RX_PushMsgFDTs(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                       uint8_t BRS_flag, uint8_t ESI_flag, uint64_t HwTime)
+{
+    CC_RX_Store(Instance, ID, Data, DLC, IDE_flag, 1, BRS_flag, ESI_flag, HwTime);
+}
+#endif
+
+/**
+ * @brief Initializes the 64-bit extension of a wrapping hardware timer.
+ *
+ * @param[out] Ext Pointer to the extension state.
+ * @param[in] Bits Width of the hardware timer in bits (1-32).
+ */
+void CC_HwTime_ExtInit(CC_hwtime_ext_t *Ext, uint8_t Bits)
+{
+    assert((NULL != Ext) && (Bits >= 1) && (Bits <= 32));
+
+    Ext->Time = 0;
+    Ext->Mask = (Bits >= 32) ? UINT32_MAX : (uint32_t)((1ul << Bits) - 1u);
+}
+
+/**
+ * @brief Extends a raw hardware timer value to a 64-bit monotonic time.
+ *
+ * Adds the distance travelled by the timer since the previous call, taken modulo the
+ * timer range, so the result only stays exact if the timer wrapped at most once.
+ *
+ * @param[in,out] Ext Pointer to the extension state.
+ * @param[in] Raw Raw timer value.
+ * @return uint64_t Monotonic 64-bit timer value.
+ */
+uint64_t CC_HwTime_Extend(CC_hwtime_ext_t *Ext, uint32_t Raw)
+{
+    assert(NULL != Ext);
+
+    Ext->Time += (uint32_t)((Raw - (uint32_t)Ext->Time) & Ext->Mask);
+    return Ext->Time;
+}
+#endif
+
+/**
+ * @brief Pushes a burst of raw CAN messages into the RX instance buffer.
+ *
+ * Reserves room for the whole burst with a single check of the ring state,
+ * copies the accepted frames and publishes them at once. Frames that do not
+ * fit are dropped from the end of the burst. With CC_RX_MAILBOX, frames of
+ * CC_RX_MODE_LATEST entries are written to their mailboxes and take no room.
+ *
+ * @param[in,out] Instance Pointer to the RX instance where the messages will be stored.
+ * @param[in] Msgs Pointer to the array of received frames.
+ * @param[in] Count Number of frames in Msgs.
+ * @param[in] UseMsgTime If non-zero, the `Time` field of each frame (e.g. a hardware
+ *            timestamp) is kept; otherwise all frames share one system tick read.
+ * @return uint16_t Number of frames accepted into the buffer or a mailbox. Frames longer
+ *         than the instance payload size are dropped as well.
+ */
+uint16_t CC_RX_PushMsgBatch(CC_RX_instance_t *Instance, const CC_RX_message_t *Msgs, uint16_t Count,
+                            uint8_t UseMsgTime)
+{
+    assert((Instance != NULL) && ((Msgs != NULL) || (0 == Count)));
+
+    CC_ring_t *Ring = &Instance->Ring;
+    uint16_t head = CC_Index_Load(&Ring->Head);
+    uint16_t Free = CC_Ring_Free(Ring);
+
+    if (0 == Count)
+    {
+        return 0;
+    }
+
+    CC_TIME_VAL_t Now = UseMsgTime ? (CC_TIME_VAL_t)0 : (CC_TIME_VAL_t)CC_INSTANCE_TICK(Instance);
+
+    uint16_t Accepted = 0;
+    uint16_t Queued = 0;
+#if CC_LATENCY
+    uint32_t Stamp = CC_Cycles();
+#endif
+
+    for (uint16_t i = 0; i < Count; i++)
+    {
+        uint8_t Len = CC_DlcToLen(Msgs[i].DLC, CC_RX_MsgFdf(&Msgs[i]));
+
+#if CC_TRACE
+        if (NULL != Instance->Trace)
+        {
+            CC_Trace_Rx(Instance->Trace, &Msgs[i], Msgs[i].Data, UseMsgTime ? Msgs[i].Time : Now);
+        }
+#endif
+#if CC_GATEWAY
+        if ((0 != Instance->RouteIsr) && CC_RX_Route(Instance, &Msgs[i], Msgs[i].Data, CC_ROUTE_ISR))
+        {
+            Accepted++;
+            continue;
+        }
+#endif
+#if CC_RX_MAILBOX
+        CC_RX_table_t *Entry =
+            CC_RX_MailboxFind(Instance, Msgs[i].ID, Msgs[i].IDE_flag, Msgs[i].DLC, CC_RX_MsgFdf(&Msgs[i]));
+
+        if (NULL != Entry)
+        {
+            CC_RX_message_t *Box = CC_RX_MailboxBegin(Instance, Entry);
+
+            CC_RX_MsgCopy(Box, &Msgs[i], Len);
+            Box->Time = UseMsgTime ? Msgs[i].Time : Now;
+            CC_RX_MailboxEnd(Instance, Entry);
+            Accepted++;
+            continue;
+        }
+#endif
+#if CC_FD_SUPPORT
+        if (Len > Instance->PayloadSize)
+        {
+#if CC_STATS_ENABLE
+            Instance->Stats.DroppedOversize++;
+#endif
+            continue;
+        }
+#endif
+        if (Queued == Free)
+        {
+#if CC_STATS_ENABLE
+            Instance->Stats.DroppedFull++;
+#endif
+            continue;
+        }
+
+        head = CC_Ring_Next(Ring, head);
+
+        CC_RX_message_t *Slot = &Instance->Buf[head];
+
+        CC_RX_MsgCopy(Slot, &Msgs[i], Len);
+        Slot->Time = UseMsgTime ? Msgs[i].Time : Now;
+#if CC_LATENCY
+        Slot->Stamp = Stamp;
+#endif
+        Queued++;
+        Accepted++;
+    }
+
+    if (0 == Queued)
+    {
+        return Accepted;
+    }
+
+#if CC_STATS_ENABLE
+    uint16_t Level = (uint16_t)(Ring->Size - 1u - (Free - Queued));
+    if (Level > Instance->Stats.HighWater)
+    {
+        Instance->Stats.HighWater = Level;
+    }
+    Instance->Stats.Pushed += Queued;
+#endif
+
+    CC_Index_Release(&Ring->Head, head);
+    CC_RX_Notify(Instance);
+    CC_RX_Wake(Instance, Queued);
+    return Accepted;
+}
+
+/**
+ * @brief Returns the number of messages that can still be pushed to the receive buffer.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @return uint16_t Number of free receive buffer slots.
+ */
+uint16_t CC_RX_FreeCount(CC_RX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    return CC_Ring_Free(&Instance->Ring);
+}
+
+/**
+ * @brief Helper function to search for a received message in the RX message table.
+ *
+ * This function checks if the given received message matches any entry in the RX
+ * table of the specified instance. It returns the registration status indicating
+ * whether the message is registered or unregistered.
+ *
+ * @param[in] Instance Pointer to the RX instance containing the RX table.
+ * @param[in] Msg Pointer to the received CAN message to search for.
+ * @return CC_MsgRegStatus_t Returns CC_MSG_REG if the message is registered in the table,
+ *         otherwise CC_MSG_UNREG.
+ */
+static inline CC_MsgRegStatus_t CC_RX_MsgFromTables(CC_RX_instance_t *Instance, CC_RX_message_t *Msg)
+{
+    assert(Instance != NULL);
+
+    if (NULL == Instance->RxTable)
+    {
+        return CC_MSG_UNREG;
+    }
+
+    CC_RX_table_t *Entry;
+#if CC_LATENCY
+    uint32_t Start;
+#endif
+
+    if (NULL != Instance->Dispatch)
+    {
+#if CC_LATENCY
+        Start = CC_Cycles();
+#endif
+        Entry = Instance->Dispatch(Instance, Msg);
+        if (NULL == Entry)
+        {
+            return CC_MSG_UNREG;
+        }
+    }
+    else
+    {
+        Entry = CC_RX_Lookup(Instance, Msg->ID, Msg->IDE_flag, Msg->DLC, CC_RX_MsgFdf(Msg));
+        if (NULL == Entry)
+        {
+            return CC_MSG_UNREG;
+        }
+#if CC_LATENCY
+        Start = CC_Cycles();
+#endif
+        Entry->Parser(Instance, Msg, Entry->SlotNo);
+    }
+
+#if CC_LATENCY
+    uint32_t Parser = CC_Cycles() - Start;
+
+    CC_Hist_Add(&Instance->Latency.Parser, Parser);
+    if (NULL != Instance->SlotLatency)
+    {
+        CC_RX_latency_t *Slot = &Instance->SlotLatency[Entry - Instance->RxTable];
+
+        CC_Hist_Add(&Slot->Wait, Start - Msg->Stamp);
+        CC_Hist_Add(&Slot->Parser, Parser);
+    }
+#endif
+
+#if CC_STATS_ENABLE
+    Entry->RxCount++;
+#endif
+    Entry->LastTick = Msg->Time;
+    return CC_MSG_REG;
+}
+
+/**
+ * @brief Helper function to check for message timeouts in the RX instance.
+ *
+ * This function visits only the entries whose scheduled deadline has passed.
+ * Receptions update `LastTick` without touching the scheduler, so a due entry
+ * is first checked against its real `LastTick`: if a message arrived in the
+ * meantime the entry is simply rescheduled, otherwise the user-defined
+ * TimeoutCallback function is called for the respective message slot.
+ * A due entry whose `TimeOut` was cleared is removed from the scheduler.
+ *
+ * @param[in] Instance Pointer to the RX instance to check for timeouts.
+ * @param[in] Now Current tick of the instance.
+ */
+static void CC_Timeout_Check(CC_RX_instance_t *Instance, CC_TIME_VAL_t Now)
+{
+    CC_sched_t *Sched = &Instance->TimeoutSched;
+
+    if (0 == Sched->Count)
+    {
+        return;
+    }
+
+    CC_sched_node_t *Node;
+#if CC_PROFILE
+    uint32_t Start = CC_Cycles();
+    uint32_t Visited = 0;
+#endif
+
+    CC_Sched_Prepare(Sched, Now);
+
+    while (NULL != (Node = CC_Sched_Due(Sched, Now)))
+    {
+        CC_RX_table_t *Entry = &Instance->RxTable[Node->Idx];
+
+#if CC_PROFILE
+        Visited++;
+#endif
+        if (0 == Entry->TimeOut)
+        {
+            CC_Sched_Remove(Sched, Now);
+            continue;
+        }
+
+        if ((CC_TIME_VAL_t)(Now - Entry->LastTick) >= Entry->TimeOut)
+        {
+            Entry->LastTick = Now;
+#if CC_STATS_ENABLE
+            Entry->TimeoutCount++;
+#endif
+            if (NULL != Instance->TimeoutCallback)
+            {
+                Instance->TimeoutCallback(Instance, Entry->SlotNo);
+            }
+        }
+        CC_Sched_Reschedule(Sched, Entry->LastTick, Entry->TimeOut, Now);
+    }
+#if CC_PROFILE
+    if (0 != Visited)
+    {
+        CC_Profile_Add(&Instance->Profile.Timeout, Start, Visited);
+    }
+#endif
+}
+
+/**
+ * @brief Returns the oldest unread message of the RX instance buffer.
+ *
+ * The message stays in the buffer, and is not overwritten by the producer,
+ * until CC_RX_Release is called.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @return CC_RX_message_t* Pointer to the message slot, or NULL if the buffer is empty.
+ */
+CC_RX_message_t *CC_RX_Peek(CC_RX_instance_t *Instance)
+{
+    assert(Instance != NULL);
+
+    uint16_t Idx;
+
+    if (0 == CC_Ring_Peek(&Instance->Ring, &Idx))
+    {
+        return NULL;
+    }
+    return &Instance->Buf[Idx];
+}
+
+/**
+ * @brief Releases the message returned by the last successful CC_RX_Peek call.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ */
+void CC_RX_Release(CC_RX_instance_t *Instance)
+{
+    assert(Instance != NULL);
+
+    CC_Ring_Release(&Instance->Ring, 1);
+}
+
+#if CC_RX_MAILBOX
+/**
+ * @brief Helper function to parse the mailboxes queued as updated by the producer.
+ *
+ * Only the queued mailboxes are visited. A mailbox is removed from the queue before it
+ * is read, so a message written meanwhile queues it again for the next call.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ */
+static void CC_RX_MailboxDispatch(CC_RX_instance_t *Instance)
+{
+    uint16_t Head = CC_Index_Acquire(&Instance->MailboxHead);
+    uint16_t Tail = CC_Index_Load(&Instance->MailboxTail);
+
+    if (Head == Tail)
+    {
+        return;
+    }
+
+    CC_RX_message_t Msg;
+#if CC_FD_SUPPORT
+    uint8_t Data[CC_MAX_DATA_LEN];
+
+    Msg.Data = Data;
+#endif
+
+    while (Tail != Head)
+    {
+        CC_RX_table_t *Entry = &Instance->RxTable[CC_RX_MailboxQueueAt(Instance, Tail)->MailboxIdx];
+        CC_RX_mailbox_t *Mailbox = Entry->Mailbox;
+
+        Tail = CC_RX_MailboxNext(Instance, Tail);
+        CC_Index_Release(&Instance->MailboxTail, Tail);
+        CC_Index_Release(&Mailbox->Drained, (uint16_t)(CC_Index_Load(&Mailbox->Drained) + 1u));
+        CC_Fence_Full();
+
+        if (CC_RX_MailboxTake(Entry, &Msg))
+        {
+#if CC_GATEWAY
+            if ((Instance->RouteCount > Instance->RouteIsr) && CC_RX_Route(Instance, &Msg, Msg.Data, 0))
+            {
+                continue;
+            }
+#endif
+#if CC_STATS_ENABLE
+            Entry->RxCount++;
+#endif
+            Entry->Parser(Instance, &Msg, Entry->SlotNo);
+            Entry->LastTick = Msg.Time;
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Helper function to offer a received message to the protocol handlers.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[in,out] Msg Pointer to the received message.
+ * @return uint8_t Non-zero if a handler consumed the message.
+ */
+static inline uint8_t CC_RX_Hooks(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg)
+{
+    for (CC_RX_hook_t *Hook = Instance->Hooks; NULL != Hook; Hook = Hook->Next)
+    {
+        if (Hook->Handler(Hook, Instance, Msg))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Helper function to check whether an RX instance holds messages to dispatch.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @return uint8_t Non-zero if the receive buffer or the dirty mailbox queue is not empty.
+ */
+static inline uint8_t CC_RX_Pending(const CC_RX_instance_t *Instance)
+{
+    if (CC_Index_Acquire(&Instance->Ring.Head) != CC_Index_Load(&Instance->Ring.Tail))
+    {
+        return 1;
+    }
+#if CC_RX_MAILBOX
+    if (CC_Index_Acquire(&Instance->MailboxHead) != CC_Index_Load(&Instance->MailboxTail))
+    {
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+/**
+ * @brief Helper function to dispatch all buffered messages of an RX instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ */
+static void CC_RX_Dispatch(CC_RX_instance_t *Instance)
+{
+    CC_RX_message_t *Msg;
+#if CC_PROFILE
+    uint32_t Start = CC_Cycles();
+    uint32_t Frames = 0;
+#endif
+
+    while (NULL != (Msg = CC_RX_Peek(Instance)))
+    {
+#if CC_PROFILE
+        Frames++;
+#endif
+#if CC_LATENCY
+        CC_Hist_Add(&Instance->Latency.Wait, CC_Cycles() - Msg->Stamp);
+#endif
+#if CC_GATEWAY
+        if ((Instance->RouteCount > Instance->RouteIsr) && CC_RX_Route(Instance, Msg, Msg->Data, 0))
+        {
+            CC_RX_Release(Instance);
+            continue;
+        }
+#endif
+        if ((NULL != Instance->Hooks) && CC_RX_Hooks(Instance, Msg))
+        {
+            CC_RX_Release(Instance);
+            continue;
+        }
+        if (CC_RX_MsgFromTables(Instance, Msg) != CC_MSG_REG)
+        {
+#if CC_STATS_ENABLE
+            Instance->Stats.Unregistered++;
+#endif
+            if (NULL != Instance->Parser_unreg_msg)
+            {
+                Instance->Parser_unreg_msg(Instance, Msg);
+            }
+        }
+        CC_RX_Release(Instance);
+    }
+#if CC_PROFILE
+    if (0 != Frames)
+    {
+        CC_Profile_Add(&Instance->Profile.Dispatch, Start, Frames);
+    }
+#endif
+#if CC_RX_MAILBOX
+    CC_RX_MailboxDispatch(Instance);
+#endif
+}
+
+/**
+ * @brief Processes received CAN messages and handles timeouts.
+ *
+ * This function should be called regularly in the main loop.
+ * It processes all pending messages in the RX buffer, attempts to parse them using
+ * the registered parsers or the unregistered message parser if applicable,
+ * and checks for message timeouts by invoking timeout callbacks.
+ *
+ * @param[in,out] Instance Pointer to the RX instance to process.
+ */
+void CC_RX_Poll(CC_RX_instance_t *Instance)
+{
+    assert(Instance != NULL);
+
+    CC_Timeout_Check(Instance, CC_INSTANCE_TICK(Instance));
+    CC_RX_Dispatch(Instance);
+}
+
+/**
+ * @brief Returns the time until an RX instance needs the next CC_RX_Poll call.
+ *
+ * Pending messages are checked as well, which closes the window in which a frame
+ * pushed during CC_RX_Poll did not fire the wakeup callback.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @return CC_TIME_VAL_t System ticks until the next timeout check, 0 if messages are
+ *         waiting or a timeout is due, or CC_MAX_TIMEOUT if no entry is supervised.
+ */
+CC_TIME_VAL_t CC_RX_NextEvent(CC_RX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    CC_sched_t *Sched = &Instance->TimeoutSched;
+
+    if (CC_RX_Pending(Instance))
+    {
+        return 0;
+    }
+    if (0 == Sched->Count)
+    {
+        return (CC_TIME_VAL_t)CC_MAX_TIMEOUT;
+    }
+
+    CC_TIME_VAL_t Now = CC_INSTANCE_TICK(Instance);
+
+    CC_Sched_Prepare(Sched, Now);
+    return CC_Sched_Remaining(CC_Sched_Node(Sched, 0), Now);
+}
+
+/**
+ * @brief Helper function to get the next message to be sent.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ * @return CC_TX_message_t* Pointer to the next message, or NULL if the buffer is empty.
+ */
+static inline CC_TX_message_t *CC_TX_Front(CC_TX_instance_t *Instance)
+{
+#if CC_TX_PRIORITY_QUEUE
+    return (Instance->Count > 0) ? &Instance->Buf[0] : NULL;
+#else
+    uint16_t Idx;
+
+    if (0 == CC_Ring_Peek(&Instance->Ring, &Idx))
+    {
+        return NULL;
+    }
+    return &Instance->Buf[Idx];
+#endif
+}
+
+/**
+ * @brief Helper function to remove the message returned by CC_TX_Front.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ */
+static inline void CC_TX_Pop(CC_TX_instance_t *Instance)
+{
+#if CC_TX_PRIORITY_QUEUE
+    uint16_t Count = --Instance->Count;
+    CC_TX_message_t Last = Instance->Buf[Count];
+    uint16_t Pos = 0;
+
+    /* Park the sent slot past the heap end so its payload storage is not lost. */
+    Instance->Buf[Count] = Instance->Buf[0];
+
+    for (;;)
+    {
+        uint16_t Child = (uint16_t)(2u * Pos + 1u);
+        if (Child >= Count)
+        {
+            break;
+        }
+        if ((Child + 1u < Count) && CC_TX_Before(&Instance->Buf[Child + 1u], &Instance->Buf[Child]))
+        {
+            Child++;
+        }
+        if (!CC_TX_Before(&Instance->Buf[Child], &Last))
+        {
+            break;
+        }
+        Instance->Buf[Pos] = Instance->Buf[Child];
+        Pos = Child;
+    }
+    if (Pos < Count)
+    {
+        Instance->Buf[Pos] = Last;
+    }
+#else
+    CC_Ring_Release(&Instance->Ring, 1);
+#endif
+}
+
+/**
+ * @brief Helper function to get the next messages to be sent as one contiguous run.
+ *
+ * In ring mode the run ends at the buffer head or at the end of the storage,
+ * whichever comes first. In priority mode the run is a single message, since
+ * the following one is only known after the heap is reordered.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ * @param[out] Run Number of messages in the run.
+ * @return CC_TX_message_t* Pointer to the first message, or NULL if the buffer is empty.
+ */
+static inline CC_TX_message_t *CC_TX_FrontRun(CC_TX_instance_t *Instance, uint16_t *Run)
+{
+#if CC_TX_PRIORITY_QUEUE
+    *Run = 1;
+    return CC_TX_Front(Instance);
+#else
+    uint16_t Idx;
+
+    *Run = CC_Ring_Peek(&Instance->Ring, &Idx);
+    return (0 == *Run) ? NULL : &Instance->Buf[Idx];
+#endif
+}
+
+/**
+ * @brief Helper function to remove the first `Count` messages returned by CC_TX_FrontRun.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] Count Number of messages to remove.
+ */
+static inline void CC_TX_PopRun(CC_TX_instance_t *Instance, uint16_t Count)
+{
+#if CC_TX_PRIORITY_QUEUE
+    while (Count-- > 0)
+    {
+        CC_TX_Pop(Instance);
+    }
+#else
+    CC_Ring_Release(&Instance->Ring, Count);
+#endif
+}
+
+/**
+ * @brief Helper function to copy a CAN frame into the TX instance buffer.
+ *
+ * @param[in,out] Instance Pointer to the TX instance where the message will be queued.
+ * @param[in] ID        CAN message identifier.
+ * @param[in] Data      Pointer to the data bytes to be sent.
+ * @param[in] DLC       Data Length Code (0-15).
+ * @param[in] IDE_flag  Identifier Extension flag.
+ * @param[in] FDF_flag  FD Format flag (ignored without CC_FD_SUPPORT).
+ * @param[in] BRS_flag  Bit Rate Switch flag (ignored without CC_FD_SUPPORT).
+ */
+static void CC_TX_Store(CC_TX_instance_t *Instance, uint32_t ID, const uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                        uint8_t FDF_flag, uint8_t BRS_flag)
+{
+    assert(Instance != NULL);
+
+    uint8_t Len = CC_DlcToLen(DLC, FDF_flag);
+
+#if CC_FD_SUPPORT
+    if (Len > Instance->PayloadSize)
+    {
+#if CC_STATS_ENABLE
+        Instance->Stats.DroppedOversize++;
+#endif
+        return;
+    }
+#else
+    (void)FDF_flag;
+    (void)BRS_flag;
+#endif
+
+    CC_TX_message_t *Slot = CC_TX_Acquire(Instance);
+
+    if (NULL == Slot)
+    {
+        return;
+    }
+
+    Slot->ID = ID;
+    Slot->DLC = DLC;
+    Slot->IDE_flag = IDE_flag;
+#if CC_FD_SUPPORT
+    Slot->FDF_flag = FDF_flag;
+    Slot->BRS_flag = BRS_flag;
+#endif
+
+    if (Len > 0)
+    {
+        CopyBuf(Data, Slot->Data, Len);
+    }
+
+    CC_TX_Publish(Instance);
+}
+
+/**
+ * @brief Asynchronously sends a CAN message by pushing it into the TX buffer.
+ *
+ * This function places a new message into the transmit buffer of the specified
+ * TX instance. It can be used to send messages outside of the configured TX table.
+ *
+ * @param[in,out] Instance Pointer to the TX instance where the message will be queued.
+ * @param[in] ID        CAN message identifier.
+ * @param[in] Data      Pointer to the data bytes to be sent (up to 8 bytes).
+ * @param[in] DLC       Data Length Code (0-15, codes above 8 carry 8 bytes).
+ * @param[in] IDE_flag  Identifier Extension flag (0 for standard, 1 for extended).
+ */
+void CC_TX_PushMsg(CC_TX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag)
+{
+    CC_TX_Store(Instance, ID, Data, DLC, IDE_flag, 0, 0);
+}
+
+/**
+ * @brief Returns the number of messages that can still be pushed to the transmit buffer.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ * @return uint16_t Number of free transmit buffer slots.
+ */
+uint16_t CC_TX_FreeCount(CC_TX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+#if CC_TX_PRIORITY_QUEUE
+    return (uint16_t)(Instance->Ring.Size - Instance->Count);
+#else
+    return CC_Ring_Free(&Instance->Ring);
+#endif
+}
+
+/**
+ * @brief Reads the tick source of a TX instance.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ * @return CC_TIME_VAL_t Current tick of the instance.
+ */
+CC_TIME_VAL_t CC_TX_TickGet(const CC_TX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    return CC_INSTANCE_TICK(Instance);
+}
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Asynchronously sends a CAN FD message by pushing it into the TX buffer.
+ *
+ * @param[in,out] Instance Pointer to the TX instance where the message will be queued.
+ * @param[in] ID        CAN message identifier.
+ * @param[in] Data      Pointer to the data bytes to be sent (up to 64 bytes).
+ * @param[in] DLC       Data Length Code (0-15).
+ * @param[in] IDE_flag  Identifier Extension flag (0 for standard, 1 for extended).
+ * @param[in] BRS_flag  Bit Rate Switch flag.
+ */
+void CC_TX_PushMsgFD(CC_TX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                     uint8_t BRS_flag)
+{
+    CC_TX_Store(Instance, ID, Data, DLC, IDE_flag, 1, BRS_flag);
+}
+#endif
+
+/**
+ * @brief Helper function to prepare the payload of a TX table entry.
+ *
+ * Copies the entry data into a scratch buffer and lets the entry parser update it.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ * @param[in,out] Entry Pointer to the TX table entry.
+ * @param[out] Temp Scratch buffer of CC_MAX_DATA_LEN bytes.
+ * @return uint8_t Number of payload bytes.
+ */
+static inline uint8_t CC_TX_EntryPrepare(CC_TX_instance_t *Instance, CC_TX_table_t *Entry, uint8_t *Temp)
+{
+#if CC_FD_SUPPORT
+    uint8_t Len = CC_DlcToLen(Entry->DLC, Entry->FDF_flag);
+#else
+    uint8_t Len = CC_DlcToLen(Entry->DLC, 0);
+#endif
+
+    if (Len > 0)
+    {
+        CopyBuf(Entry->Data, Temp, Len);
+    }
+    if (NULL != Entry->Parser)
+    {
+        Entry->Parser(Instance, Temp, Entry);
+    }
+    return Len;
+}
+
+/**
+ * @brief Helper function to queue the prepared payload of a TX table entry.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in,out] Entry Pointer to the TX table entry.
+ * @param[in] Temp Payload returned by CC_TX_EntryPrepare.
+ * @param[in] Now Current system tick.
+ */
+static inline void CC_TX_EntryStore(CC_TX_instance_t *Instance, CC_TX_table_t *Entry, const uint8_t *Temp,
+                                    CC_TIME_VAL_t Now)
+{
+#if CC_FD_SUPPORT
+    uint8_t FDF_flag = Entry->FDF_flag;
+    uint8_t BRS_flag = Entry->BRS_flag;
+#else
+    uint8_t FDF_flag = 0;
+    uint8_t BRS_flag = 0;
+#endif
+
+    Entry->LastTick = Now;
+    CC_TX_Store(Instance, Entry->ID, Temp, Entry->DLC, Entry->IDE_flag, FDF_flag, BRS_flag);
+}
+
+#if CC_TX_ON_CHANGE
+/**
+ * @brief Helper function to check an on-change TX table entry.
+ *
+ * Sends the entry if its payload differs from the last sent one or if its heartbeat
+ * period has elapsed, and records the sent payload in the entry shadow.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in,out] Entry Pointer to the TX table entry.
+ * @param[out] Temp Scratch buffer of CC_MAX_DATA_LEN bytes.
+ * @param[in] Now Current system tick.
+ */
+static inline void CC_TX_EntryOnChange(CC_TX_instance_t *Instance, CC_TX_table_t *Entry, uint8_t *Temp,
+                                       CC_TIME_VAL_t Now)
+{
+    uint8_t Len = CC_TX_EntryPrepare(Instance, Entry, Temp);
+    uint8_t Changed = ((CC_TIME_VAL_t)(Now - Entry->LastTick) >= Entry->SendFreq);
+
+    for (uint8_t i = 0; (i < Len) && !Changed; i++)
+    {
+        Changed = (Temp[i] != Entry->Shadow[i]);
+    }
+
+    if (Changed)
+    {
+        if (Len > 0)
+        {
+            CopyBuf(Temp, Entry->Shadow, Len);
+        }
+        CC_TX_EntryStore(Instance, Entry, Temp, Now);
+    }
+}
+#endif
+
+/**
+ * @brief Helper function that processes TX messages from the transmit table.
+ *
+ * This internal function takes the due entries of the TX message table from the send
+ * scheduler, so its cost depends on the number of due messages rather than on the table
+ * size. A due cyclic entry is rechecked against its current `LastTick` and `SendFreq`, so
+ * an entry changed at runtime is sent on its real deadline and rescheduled from it.
+ * On-change entries are checked every `MinInterval` ticks instead.
+ *
+ * @param[in,out] Instance Pointer to the TX instance whose TX table will be processed.
+ * @param[in] Now Current tick of the instance.
+ */
+static inline void CC_TX_MsgFromTables(CC_TX_instance_t *Instance, CC_TIME_VAL_t Now)
+{
+    assert(NULL != Instance);
+
+    CC_sched_t *Sched = &Instance->SendSched;
+
+    if (0 == Sched->Count)
+    {
+        return;
+    }
+
+    uint8_t Temp[CC_MAX_DATA_LEN];
+    CC_sched_node_t *Node;
+#if CC_PROFILE
+    uint32_t Start = CC_Cycles();
+    uint32_t Visited = 0;
+#endif
+
+    CC_Sched_Prepare(Sched, Now);
+
+    while (NULL != (Node = CC_Sched_Due(Sched, Now)))
+    {
+        CC_TX_table_t *Entry = &Instance->TxTable[Node->Idx];
+
+#if CC_PROFILE
+        Visited++;
+#endif
+#if CC_TX_ON_CHANGE
+        if (CC_TX_MODE_ON_CHANGE == Entry->Mode)
+        {
+            CC_TX_EntryOnChange(Instance, Entry, Temp, Now);
+            CC_Sched_Reschedule(Sched, Now, (0 != Entry->MinInterval) ? Entry->MinInterval : (CC_TIME_VAL_t)1,
+                                Now);
+            continue;
+        }
+#endif
+
+        if ((CC_TIME_VAL_t)(Now - Entry->LastTick) >= Entry->SendFreq)
+        {
+            CC_TX_EntryPrepare(Instance, Entry, Temp);
+            CC_TX_EntryStore(Instance, Entry, Temp, Now);
+        }
+        /* A zero period would stay due forever; such entries are sent once per tick. */
+        CC_Sched_Reschedule(Sched, Entry->LastTick, (0 != Entry->SendFreq) ? Entry->SendFreq : (CC_TIME_VAL_t)1,
+                            Now);
+    }
+#if CC_PROFILE
+    if (0 != Visited)
+    {
+        CC_Profile_Add(&Instance->Profile.Tables, Start, Visited);
+    }
+#endif
+}
+
+/**
+ * @brief Hands queued messages to the hardware up to its number of free TX slots.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] Now Current tick of the instance.
+ */
+static void CC_TX_SendRuns(CC_TX_instance_t *Instance, CC_TIME_VAL_t Now)
+{
+    uint16_t Free = Instance->FreeSlots(Instance);
+    uint16_t Run;
+    CC_TX_message_t *Msg;
+#if CC_PROFILE
+    uint32_t Start = CC_Cycles();
+    uint32_t Total = 0;
+#endif
+
+#if !CC_TRACE
+    (void)Now;
+#endif
+
+    while (NULL != (Msg = CC_TX_FrontRun(Instance, &Run)))
+    {
+        if (0 == Free)
+        {
+#if CC_STATS_ENABLE
+            Instance->Stats.BusBusy++;
+#endif
+            break;
+        }
+        if (Run > Free)
+        {
+            Run = Free;
+        }
+
+        uint16_t Sent;
+        if (NULL != Instance->SendBatch)
+        {
+            Sent = Instance->SendBatch(Instance, Msg, Run);
+            assert(Sent <= Run);
+        }
+        else
+        {
+            assert(NULL != Instance->SendFunction);
+            for (Sent = 0; Sent < Run; Sent++)
+            {
+                Instance->SendFunction(Instance, &Msg[Sent]);
+            }
+        }
+
+#if CC_TRACE
+        CC_Trace_Tx(Instance, Msg, Sent, Now);
+#endif
+#if CC_LATENCY
+        uint32_t Done = CC_Cycles();
+
+        for (uint16_t i = 0; i < Sent; i++)
+        {
+            CC_Hist_Add(&Instance->Latency, Done - Msg[i].Stamp);
+        }
+#endif
+        CC_TX_PopRun(Instance, Sent);
+#if CC_PROFILE
+        Total += Sent;
+#endif
+        if (Sent < Run)
+        {
+#if CC_STATS_ENABLE
+            Instance->Stats.BusBusy++;
+#endif
+            break;
+        }
+        Free -= Sent;
+    }
+#if CC_PROFILE
+    if (0 != Total)
+    {
+        CC_Profile_Add(&Instance->Profile.Send, Start, Total);
+    }
+#endif
+}
+
+/**
+ * @brief Helper function to poll a TX instance at a given tick.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] Now Current tick of the instance.
+ */
+static void CC_TX_PollAt(CC_TX_instance_t *Instance, CC_TIME_VAL_t Now)
+{
+    assert((NULL != Instance) && ((NULL != Instance->BusCheck) || (NULL != Instance->FreeSlots)));
+
+    CC_TX_MsgFromTables(Instance, Now);
+
+    if (NULL != Instance->FreeSlots)
+    {
+        CC_TX_SendRuns(Instance, Now);
+        return;
+    }
+
+    CC_TX_message_t *Msg;
+#if CC_PROFILE
+    uint32_t Start = CC_Cycles();
+    uint32_t Sent = 0;
+#endif
+
+    while (NULL != (Msg = CC_TX_Front(Instance)))
+    {
+        if (Instance->BusCheck(Instance) != CC_BUS_FREE)
+        {
+#if CC_STATS_ENABLE
+            Instance->Stats.BusBusy++;
+#endif
+            break;
+        }
+
+        assert(NULL != Instance->SendFunction);
+#if CC_LATENCY
+        CC_Hist_Add(&Instance->Latency, CC_Cycles() - Msg->Stamp);
+#endif
+        Instance->SendFunction(Instance, Msg);
+#if CC_TRACE
+        CC_Trace_Tx(Instance, Msg, 1, Now);
+#endif
+        CC_TX_Pop(Instance);
+#if CC_PROFILE
+        Sent++;
+#endif
+    }
+#if CC_PROFILE
+    if (0 != Sent)
+    {
+        CC_Profile_Add(&Instance->Profile.Send, Start, Sent);
+    }
+#endif
+}
+
+/**
+ * @brief Poll function to handle CAN transmission for a single TX instance.
+ *
+ * This function should be called regularly in the main loop. It manages the transmission
+ * of CAN messages by checking the bus state, preparing messages from the TX table, and
+ * invoking the configured send function when the bus is free.
+ *
+ * @param[in,out] Instance Pointer to the TX instance to be processed.
+ */
+void CC_TX_Poll(CC_TX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    CC_TX_PollAt(Instance, CC_INSTANCE_TICK(Instance));
+}
+
+/**
+ * @brief Returns the time until the next cyclic message of a TX instance is due.
+ *
+ * The earliest heap node may be due earlier than its entry when the entry was
+ * changed at runtime, so the result never exceeds the real time to the deadline.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @return CC_TIME_VAL_t System ticks until the next deadline, 0 if a message is due,
+ *         or CC_MAX_TIMEOUT if the TX table is empty.
+ */
+CC_TIME_VAL_t CC_TX_NextEvent(CC_TX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    CC_sched_t *Sched = &Instance->SendSched;
+
+    if (0 == Sched->Count)
+    {
+        return (CC_TIME_VAL_t)CC_MAX_TIMEOUT;
+    }
+
+    CC_TIME_VAL_t Now = CC_INSTANCE_TICK(Instance);
+
+    CC_Sched_Prepare(Sched, Now);
+    return CC_Sched_Remaining(CC_Sched_Node(Sched, 0), Now);
+}
+
+/**
+ * @brief Reports that a hardware TX mailbox of the instance became free.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ */
+void CC_TX_MailboxFree(CC_TX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    if (NULL == Instance->WakeCallback)
+    {
+        return;
+    }
+
+#if CC_TX_PRIORITY_QUEUE
+    uint8_t Pending = (0 != Instance->Count);
+#else
+    uint8_t Pending = (CC_Index_Acquire(&Instance->Ring.Head) != CC_Index_Load(&Instance->Ring.Tail));
+#endif
+    if (Pending)
+    {
+        Instance->WakeCallback(Instance);
+    }
+}
+
+/**
+ * @brief Registers a tick source of a single RX instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in] Function Pointer to the instance tick function, or NULL for the global tick source.
+ */
+void CC_RX_tick_function_register(CC_RX_instance_t *Instance, CC_TIME_VAL_t (*Function)(void))
+{
+    assert(NULL != Instance);
+
+    Instance->GetTick = Function;
+}
+
+/**
+ * @brief Registers a tick source of a single TX instance.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] Function Pointer to the instance tick function, or NULL for the global tick source.
+ */
+void CC_TX_tick_function_register(CC_TX_instance_t *Instance, CC_TIME_VAL_t (*Function)(void))
+{
+    assert(NULL != Instance);
+
+    Instance->GetTick = Function;
+}
+
+/**
+ * @brief Initializes a bus group.
+ *
+ * Assigns every RX instance its ready bit. All bits start set, so messages received
+ * before the group was created are dispatched by the first pass.
+ *
+ * @param[out] Group Pointer to the bus group.
+ * @param[in] Rx Array of pointers to RX instances, or NULL.
+ * @param[in] RxCount Number of RX instances (at most 32).
+ * @param[in] Tx Array of pointers to TX instances, or NULL.
+ * @param[in] TxCount Number of TX instances.
+ */
+void CC_Group_init(CC_bus_group_t *Group, CC_RX_instance_t **Rx, uint8_t RxCount, CC_TX_instance_t **Tx,
+                   uint8_t TxCount)
+{
+    assert((NULL != Group) && (RxCount <= 32) && ((NULL != Rx) || (0 == RxCount)) &&
+           ((NULL != Tx) || (0 == TxCount)));
+
+    Group->Rx = Rx;
+    Group->RxCount = RxCount;
+    Group->Tx = Tx;
+    Group->TxCount = TxCount;
+
+#if CC_SYNC_MODE == CC_SYNC_C11
+    uint32_t All = (RxCount >= 32) ? UINT32_MAX : (uint32_t)((1ul << RxCount) - 1u);
+
+    atomic_store_explicit(&Group->Ready, All, memory_order_relaxed);
+    for (uint8_t i = 0; i < RxCount; i++)
+    {
+        Rx[i]->GroupBit = (uint32_t)1u << i;
+        Rx[i]->Group = Group;
+    }
+#endif
+}
+
+/**
+ * @brief Polls all instances of a bus group in one pass.
+ *
+ * @param[in,out] Group Pointer to the bus group.
+ */
+void CC_Group_Poll(CC_bus_group_t *Group)
+{
+    assert(NULL != Group);
+
+    CC_TIME_VAL_t Now = CC_GET_TICK;
+
+#if CC_SYNC_MODE == CC_SYNC_C11
+    uint32_t Ready = atomic_exchange_explicit(&Group->Ready, 0, memory_order_acquire);
+#endif
+
+    for (uint8_t i = 0; i < Group->RxCount; i++)
+    {
+        CC_RX_instance_t *Rx = Group->Rx[i];
+
+        CC_Timeout_Check(Rx, (NULL != Rx->GetTick) ? Rx->GetTick() : Now);
+#if CC_SYNC_MODE == CC_SYNC_C11
+        if (0 == (Ready & Rx->GroupBit))
+#else
+        if (!CC_RX_Pending(Rx))
+#endif
         {
-            Instance->Tail = 0;
+            continue;
         }
+        CC_RX_Dispatch(Rx);
+    }
 
-        assert(NULL != Instance->SendFunction);
-        Instance->SendFunction(Instance, &Instance->Buf[Instance->Tail]);
+    for (uint8_t i = 0; i < Group->TxCount; i++)
+    {
+        CC_TX_instance_t *Tx = Group->Tx[i];
+
+        CC_TX_PollAt(Tx, (NULL != Tx->GetTick) ? Tx->GetTick() : Now);
+    }
+}
+
+/**
+ * @brief Returns the time until a bus group needs the next CC_Group_Poll call.
+ *
+ * @param[in,out] Group Pointer to the bus group.
+ * @return CC_TIME_VAL_t System ticks until the next event, 0 if work is pending,
+ *         or CC_MAX_TIMEOUT if nothing is scheduled.
+ */
+CC_TIME_VAL_t CC_Group_NextEvent(CC_bus_group_t *Group)
+{
+    assert(NULL != Group);
+
+    CC_TIME_VAL_t Next = (CC_TIME_VAL_t)CC_MAX_TIMEOUT;
+
+    for (uint8_t i = 0; (i < Group->RxCount) && (0 != Next); i++)
+    {
+        CC_TIME_VAL_t Rx = CC_RX_NextEvent(Group->Rx[i]);
+
+        Next = (Rx < Next) ? Rx : Next;
+    }
+    for (uint8_t i = 0; (i < Group->TxCount) && (0 != Next); i++)
+    {
+        CC_TIME_VAL_t Tx = CC_TX_NextEvent(Group->Tx[i]);
+
+        Next = (Tx < Next) ? Tx : Next;
+    }
+    return Next;
+}
+
+#if CC_TRACE
+/**
+ * @brief Initializes a trace ring.
+ *
+ * @param[out] Trace Pointer to the trace ring.
+ * @param[in] Buf Pointer to the record storage.
+ * @param[in] Size Number of records in Buf (at least 2).
+ * @param[in] Channel Channel number stored in the records.
+ */
+void CC_Trace_init(CC_trace_t *Trace, CC_trace_record_t *Buf, uint16_t Size, uint8_t Channel)
+{
+    assert((NULL != Trace) && (NULL != Buf) && (Size >= 2));
+
+    Trace->Buf = Buf;
+    CC_Ring_Init(&Trace->Ring, Size);
+    Trace->Channel = Channel;
+    Trace->Dropped = 0;
+}
+
+/**
+ * @brief Attaches a trace ring to an RX instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in] Trace Pointer to the trace ring, or NULL to stop capturing.
+ */
+void CC_RX_Trace_attach(CC_RX_instance_t *Instance, CC_trace_t *Trace)
+{
+    assert(NULL != Instance);
+
+    Instance->Trace = Trace;
+}
+
+/**
+ * @brief Attaches a trace ring to a TX instance.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ * @param[in] Trace Pointer to the trace ring, or NULL to stop capturing.
+ */
+void CC_TX_Trace_attach(CC_TX_instance_t *Instance, CC_trace_t *Trace)
+{
+    assert(NULL != Instance);
+
+    Instance->Trace = Trace;
+}
+
+/**
+ * @brief Returns the oldest captured records as one contiguous run.
+ *
+ * @param[in,out] Trace Pointer to the trace ring.
+ * @param[out] Records Pointer receiving the address of the first record of the run.
+ * @return uint16_t Number of records in the run, 0 if the ring is empty.
+ */
+uint16_t CC_Trace_Peek(CC_trace_t *Trace, const CC_trace_record_t **Records)
+{
+    assert((NULL != Trace) && (NULL != Records));
+
+    uint16_t Idx = 0;
+    uint16_t Count = CC_Ring_Peek(&Trace->Ring, &Idx);
+
+    *Records = &Trace->Buf[Idx];
+    return Count;
+}
+
+/**
+ * @brief Releases the first `Count` records returned by CC_Trace_Peek.
+ *
+ * @param[in,out] Trace Pointer to the trace ring.
+ * @param[in] Count Number of records to release.
+ */
+void CC_Trace_Release(CC_trace_t *Trace, uint16_t Count)
+{
+    assert(NULL != Trace);
+
+    CC_Ring_Release(&Trace->Ring, Count);
+}
+#endif
+
+#if CC_STATS_ENABLE
+/**
+ * @brief Takes a snapshot of the statistics of a CAN RX instance.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[out] Stats Pointer to the structure receiving the snapshot.
+ */
+void CC_RX_StatsGet(const CC_RX_instance_t *Instance, CC_RX_stats_t *Stats)
+{
+    assert((NULL != Instance) && (NULL != Stats));
+
+    *Stats = Instance->Stats;
+}
+
+/**
+ * @brief Clears the statistics of a CAN RX instance, including per-entry counters.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ */
+void CC_RX_StatsReset(CC_RX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    Instance->Stats = (CC_RX_stats_t){0};
+    for (uint16_t i = 0; (NULL != Instance->RxTable) && (i < Instance->TableSize); i++)
+    {
+        Instance->RxTable[i].RxCount = 0;
+        Instance->RxTable[i].TimeoutCount = 0;
+    }
+}
+
+/**
+ * @brief Takes a snapshot of the statistics of a CAN TX instance.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ * @param[out] Stats Pointer to the structure receiving the snapshot.
+ */
+void CC_TX_StatsGet(const CC_TX_instance_t *Instance, CC_TX_stats_t *Stats)
+{
+    assert((NULL != Instance) && (NULL != Stats));
+
+    *Stats = Instance->Stats;
+}
+
+/**
+ * @brief Clears the statistics of a CAN TX instance.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ */
+void CC_TX_StatsReset(CC_TX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    Instance->Stats = (CC_TX_stats_t){0};
+}
+#endif
+
+#if CC_PROFILE
+/**
+ * @brief Takes a snapshot of the cycle counts of a CAN RX instance.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[out] Profile Pointer to the structure receiving the snapshot.
+ */
+void CC_RX_ProfileGet(const CC_RX_instance_t *Instance, CC_RX_profile_t *Profile)
+{
+    assert((NULL != Instance) && (NULL != Profile));
+
+    *Profile = Instance->Profile;
+}
+
+/**
+ * @brief Clears the cycle counts of a CAN RX instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ */
+void CC_RX_ProfileReset(CC_RX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    Instance->Profile = (CC_RX_profile_t){0};
+}
+
+/**
+ * @brief Takes a snapshot of the cycle counts of a CAN TX instance.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ * @param[out] Profile Pointer to the structure receiving the snapshot.
+ */
+void CC_TX_ProfileGet(const CC_TX_instance_t *Instance, CC_TX_profile_t *Profile)
+{
+    assert((NULL != Instance) && (NULL != Profile));
+
+    *Profile = Instance->Profile;
+}
+
+/**
+ * @brief Clears the cycle counts of a CAN TX instance.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ */
+void CC_TX_ProfileReset(CC_TX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    Instance->Profile = (CC_TX_profile_t){0};
+}
+#endif
+
+#if CC_LATENCY
+/**
+ * @brief Attaches per-entry latency histograms to an RX instance.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ * @param[in] Slots Pointer to `TableSize` histograms, indexed by RX table position, or NULL.
+ */
+void CC_RX_LatencySlots_attach(CC_RX_instance_t *Instance, CC_RX_latency_t *Slots)
+{
+    assert(NULL != Instance);
+
+    for (uint16_t i = 0; (NULL != Slots) && (i < Instance->TableSize); i++)
+    {
+        Slots[i] = (CC_RX_latency_t){0};
+    }
+    Instance->SlotLatency = Slots;
+}
+
+/**
+ * @brief Takes a snapshot of the latency histograms of a CAN RX instance.
+ *
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[out] Latency Pointer to the structure receiving the snapshot.
+ */
+void CC_RX_LatencyGet(const CC_RX_instance_t *Instance, CC_RX_latency_t *Latency)
+{
+    assert((NULL != Instance) && (NULL != Latency));
+
+    *Latency = Instance->Latency;
+}
+
+/**
+ * @brief Clears the latency histograms of a CAN RX instance, including per-entry ones.
+ *
+ * @param[in,out] Instance Pointer to the RX instance.
+ */
+void CC_RX_LatencyReset(CC_RX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    Instance->Latency = (CC_RX_latency_t){0};
+    for (uint16_t i = 0; (NULL != Instance->SlotLatency) && (i < Instance->TableSize); i++)
+    {
+        Instance->SlotLatency[i] = (CC_RX_latency_t){0};
+    }
+}
+
+/**
+ * @brief Takes a snapshot of the latency histogram of a CAN TX instance.
+ *
+ * @param[in] Instance Pointer to the TX instance.
+ * @param[out] Latency Pointer to the structure receiving the snapshot.
+ */
+void CC_TX_LatencyGet(const CC_TX_instance_t *Instance, CC_hist_t *Latency)
+{
+    assert((NULL != Instance) && (NULL != Latency));
+
+    *Latency = Instance->Latency;
+}
+
+/**
+ * @brief Clears the latency histogram of a CAN TX instance.
+ *
+ * @param[in,out] Instance Pointer to the TX instance.
+ */
+void CC_TX_LatencyReset(CC_TX_instance_t *Instance)
+{
+    assert(NULL != Instance);
+
+    Instance->Latency = (CC_hist_t){0};
+}
+
+/**
+ * @brief Returns an upper bound of a percentile of a latency histogram.
+ *
+ * @param[in] Hist Pointer to the histogram.
+ * @param[in] Percent Percentile (0-100).
+ * @return uint32_t Upper bound in cycles of the bucket holding the percentile, the
+ *         longest sample for the last bucket, or 0 if the histogram is empty.
+ */
+uint32_t CC_Hist_Percentile(const CC_hist_t *Hist, uint8_t Percent)
+{
+    assert((NULL != Hist) && (Percent <= 100));
+
+    uint64_t Total = 0;
+
+    for (uint16_t b = 0; b < CC_LATENCY_BINS; b++)
+    {
+        Total += Hist->Bins[b];
+    }
+    if (0 == Total)
+    {
+        return 0;
     }
+
+    /* Rank of the percentile sample, at least the first one. */
+    uint64_t Rank = (Total * Percent + 99u) / 100u;
+    uint64_t Seen = 0;
+
+    Rank = (0 == Rank) ? 1u : Rank;
+    for (uint16_t b = 0; b < CC_LATENCY_BINS - 1u; b++)
+    {
+        Seen += Hist->Bins[b];
+        if (Seen >= Rank)
+        {
+            uint32_t Bound = (0 == b) ? 0u : (uint32_t)((1ull << b) - 1u);
+
+            return (Bound < Hist->Max) ? Bound : Hist->Max;
+        }
+    }
+    return Hist->Max;
 }
+#endif
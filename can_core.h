@@ -25,20 +25,230 @@
 #define CC_TICK_FROM_FUNC 0
 
 /**
- * @def CC_RX_BUFFER_SIZE
- * @brief Size of the CAN receive buffer.
+ * @def CC_FD_SUPPORT
+ * @brief Enables CAN FD frames with payloads of up to 64 bytes.
  *
- * Defines the number of messages that can be stored in the CAN RX buffer.
+ * If set to 1, messages carry the FDF/BRS/ESI flags and the DLC field holds the
+ * DLC code (0-15), converted to a byte count with CC_DlcToLen. Message payloads
+ * are stored in per-instance storage registered with CC_RX_FD_init/CC_TX_FD_init,
+ * so classic CAN instances can keep 8-byte slots.
+ * If set to 0, messages keep a fixed 8-byte payload.
  */
-#define CC_RX_BUFFER_SIZE 32
+#define CC_FD_SUPPORT 0
 
 /**
- * @def CC_TX_BUFFER_SIZE
- * @brief Size of the CAN transmit buffer.
+ * @def CC_MAX_DATA_LEN
+ * @brief Largest payload of a single frame in bytes.
+ */
+#if CC_FD_SUPPORT
+#define CC_MAX_DATA_LEN 64
+#else
+#define CC_MAX_DATA_LEN 8
+#endif
+
+/**
+ * @def CC_STATS_ENABLE
+ * @brief Enables RX/TX statistics counters.
+ *
+ * If set to 1, each RX and TX instance keeps a statistics block (see CC_RX_stats_t
+ * and CC_TX_stats_t) and each RX table entry counts its receptions and timeouts.
+ * Counters are plain increments done by the context that owns the event, without locks.
+ */
+#define CC_STATS_ENABLE 0
+
+/**
+ * @def CC_RX_HW_TIMESTAMP
+ * @brief Enables hardware timestamps of received CAN messages.
+ *
+ * If set to 1, CC_RX_message_t gets a 64-bit `HwTime` field filled by
+ * CC_RX_PushMsgTs (or by the driver through CC_RX_Reserve), e.g. with the
+ * controller's microsecond SOF/EOF timestamp extended by CC_HwTime_Extend.
+ * The `Time` field keeps the system tick used by the timeout logic.
+ * If set to 0, messages only carry the system tick.
+ */
+#define CC_RX_HW_TIMESTAMP 0
+
+/**
+ * @def CC_RX_MAILBOX
+ * @brief Enables the latest-value mailbox mode of RX table entries.
+ *
+ * If set to 1, RX table entries get the `Mode` and `Mailbox` fields. Frames of entries
+ * in CC_RX_MODE_LATEST are matched in the pushing context and overwrite the entry's
+ * mailbox instead of taking a slot of the receive buffer, so a fast periodic sender
+ * cannot crowd out other frames, and CC_RX_Poll parses each updated mailbox once.
+ * Updated mailboxes are queued by the producer, so a poll only visits those.
+ * Push calls of instances with mailboxes pay for the table lookup.
+ * If set to 0, every registered frame is queued.
+ */
+#define CC_RX_MAILBOX 0
+
+/**
+ * @def CC_GATEWAY
+ * @brief Enables frame routing from RX instances to TX instances.
+ *
+ * If set to 1, an RX instance can be given a routing table with CC_RX_Routes_init.
+ * Matching frames are copied from the receive slot (or the pushed frame) straight
+ * into the transmit buffer of the destination instance, without a parser in between.
+ * If set to 0, frames are only forwarded by user parsers.
+ */
+#define CC_GATEWAY 0
+
+/**
+ * @def CC_TRACE
+ * @brief Enables the traffic capture tap.
+ *
+ * If set to 1, RX and TX instances can be attached to a trace ring with
+ * CC_RX_Trace_attach/CC_TX_Trace_attach. Every frame pushed into an RX instance
+ * (including frames dropped afterwards) and every frame handed to the TX driver is
+ * written as a fixed-size CC_trace_record_t, without locks and without blocking:
+ * records that do not fit are counted and dropped. See can_trace.h for replay.
+ * If set to 0, nothing is captured.
+ */
+#define CC_TRACE 0
+
+/**
+ * @def CC_PROFILE
+ * @brief Enables cycle counting of the RX and TX poll paths.
+ *
+ * If set to 1, the RX dispatch and timeout check and the TX table scan and send
+ * stages read the cycle counter registered with CC_cycle_function_register (see
+ * CC_DWT_init on Cortex-M) and accumulate the counts per instance, see
+ * CC_RX_ProfileGet/CC_TX_ProfileGet. Each measured stage costs two counter reads.
+ * If set to 0, nothing is measured.
+ * May be predefined, e.g. with `-DCC_PROFILE=1` on the compiler command line.
+ */
+#ifndef CC_PROFILE
+#define CC_PROFILE 0
+#endif
+
+/**
+ * @def CC_LATENCY
+ * @brief Enables latency histograms of the RX and TX paths.
+ *
+ * If set to 1, messages are stamped with the cycle counter registered with
+ * CC_cycle_function_register when they enter the receive or transmit buffer, and
+ * each instance records in log2 histograms how long RX messages wait until
+ * CC_RX_Poll dispatches them, how long each RX `Parser` call takes, and how long TX
+ * messages wait until they are handed to the driver. See CC_RX_LatencyGet,
+ * CC_TX_LatencyGet and CC_RX_LatencySlots_attach. Frames taken by mailboxes or ISR
+ * routes are not measured. If set to 0, nothing is measured.
+ */
+#define CC_LATENCY 0
+
+/**
+ * @def CC_LATENCY_BINS
+ * @brief Number of buckets of a latency histogram (2-33).
+ *
+ * Bucket 0 counts zero-cycle samples and bucket `b` samples of 2^(b-1) to
+ * 2^b - 1 cycles; the last bucket also counts all longer samples.
+ */
+#define CC_LATENCY_BINS 32
+
+/**
+ * @def CC_TX_PRIORITY_QUEUE
+ * @brief Enables priority ordering of the CAN transmit buffer.
+ *
+ * If set to 1, the transmit buffer is kept as a binary min-heap ordered by CAN
+ * arbitration priority, so CC_TX_Poll always hands the frame that would win
+ * arbitration (lowest ID, standard before extended with the same base ID) to the
+ * driver first. Frames with the same ID keep their push order. All `BufSize`
+ * slots are usable. The heap is not lock-free: CC_TX_PushMsg and CC_TX_Poll of an
+ * instance must run in the same context or be serialized by the caller.
+ * If set to 0, the transmit buffer is a FIFO ring.
+ */
+#define CC_TX_PRIORITY_QUEUE 0
+
+/**
+ * @def CC_TX_ON_CHANGE
+ * @brief Enables the on-change transmission mode of TX table entries.
+ *
+ * If set to 1, TX table entries get the `Mode`, `MinInterval` and `Shadow` fields,
+ * and entries in CC_TX_MODE_ON_CHANGE are sent when their payload changes,
+ * at most once per `MinInterval`, and otherwise only every `SendFreq` as a heartbeat.
+ * If set to 0, every entry is sent cyclically.
+ */
+#define CC_TX_ON_CHANGE 0
+
+/**
+ * @def CC_TX_PHASE_BINS
+ * @brief Number of phase bins used by CC_TX_AutoPhase.
+ *
+ * The shortest period of the TX table is split into this many bins, and each
+ * cyclic message is placed in the least loaded one. More bins give a finer spread
+ * at the cost of stack usage during the call.
+ */
+#define CC_TX_PHASE_BINS 16
+
+/**
+ * @def CC_COPY_MODE
+ * @brief Selects how frame payloads are copied.
+ *
+ * - CC_COPY_BYTES: Plain byte loop.
+ * - CC_COPY_WORDS: Aligned 32-bit word moves when both buffers are word aligned
+ *   (always the case for classic ring slots), byte loop for the remainder.
+ * - CC_COPY_MEMCPY: Library `memcpy`, which is usually vectorized on hosted
+ *   targets and pays off for CAN FD payloads.
+ */
+#define CC_COPY_BYTES 0
+#define CC_COPY_WORDS 1
+#define CC_COPY_MEMCPY 2
+
+#define CC_COPY_MODE CC_COPY_WORDS
+
+/**
+ * @def CC_RX_SIMD
+ * @brief Enables the vectorized search over the dense RX lookup keys.
+ *
+ * If set to 1, lookups on instances with keys attached by CC_RX_Keys_init
+ * binary-search down to a block of CC_RX_SIMD_BLOCK keys and then compare the
+ * frame key against the whole block with vector instructions: 8 keys per compare
+ * with AVX2, 4 with SSE2 or NEON, selected from the compiler's target macros.
+ * Other targets use a portable scalar loop over the block.
+ * If set to 0, the lookup is a plain binary search.
+ * tools/cc_bench.sh measures both against the plain search and a hash per table size.
+ * May be predefined on the compiler command line, like CC_RX_SIMD_BLOCK.
+ */
+#ifndef CC_RX_SIMD
+#define CC_RX_SIMD 0
+#endif
+
+/**
+ * @def CC_RX_SIMD_BLOCK
+ * @brief Number of keys scanned linearly at the end of a CC_RX_SIMD lookup.
+ */
+#ifndef CC_RX_SIMD_BLOCK
+#define CC_RX_SIMD_BLOCK 32
+#endif
+
+/**
+ * @def CC_SYNC_MODE
+ * @brief Selects how the ring buffers publish frames between producer and consumer.
  *
- * Defines the number of messages that can be stored in the CAN TX buffer.
+ * Each RX and TX ring is single-producer/single-consumer: one context pushes
+ * (e.g. the CAN RX interrupt calling CC_RX_PushMsg) and one context polls.
+ * The producer writes a frame completely before publishing the new head index,
+ * and the consumer reads the head index before reading the frame.
+ *
+ * - CC_SYNC_NONE: No ordering enforcement. Only safe if the caller serializes
+ *   pushes and polls, e.g. by disabling interrupts around CC_RX_Poll.
+ * - CC_SYNC_BARRIER: Compiler barriers around the index accesses. Sufficient
+ *   for interrupt vs. main loop on a single core (including Cortex-M7).
+ *   `CC_COMPILER_BARRIER()` may be predefined for compilers without GNU inline asm.
+ * - CC_SYNC_C11: C11 `<stdatomic.h>` acquire/release operations, for producer and
+ *   consumer running on different cores (e.g. SMP Linux ports).
  */
-#define CC_TX_BUFFER_SIZE 32
+#define CC_SYNC_NONE 0
+#define CC_SYNC_BARRIER 1
+#define CC_SYNC_C11 2
+
+#define CC_SYNC_MODE CC_SYNC_BARRIER
+
+#if CC_SYNC_MODE == CC_SYNC_C11
+#include <stdatomic.h>
+typedef _Atomic uint16_t CC_INDEX_t;
+#else
+typedef volatile uint16_t CC_INDEX_t;
+#endif
 
 /**
  * @brief System time base type and maximum timeout definition.
@@ -47,11 +257,15 @@
  * If you want to use a different type, define `CC_TIME_BASE_TYPE_CUSTOM` as that type
  * and also define the corresponding `_IS_` macro
  * (e.g., `CC_TIME_BASE_TYPE_CUSTOM_IS_UINT16`) to properly set `CC_MAX_TIMEOUT`.
+ *
+ * `CC_TIME_VAL_t` is the non-volatile value type of the same width, used for
+ * intermediate tick arithmetic inside the library.
  */
 #ifndef CC_TIME_BASE_TYPE_CUSTOM
 
 #define CC_MAX_TIMEOUT UINT32_MAX
 typedef volatile uint32_t CC_TIME_t;
+typedef uint32_t CC_TIME_VAL_t;
 
 #else
 
@@ -59,20 +273,28 @@ typedef CC_TIME_BASE_TYPE_CUSTOM CC_TIME_t;
 
 #if defined(CC_TIME_BASE_TYPE_CUSTOM_IS_UINT8)
 #define CC_MAX_TIMEOUT UINT8_MAX
+typedef uint8_t CC_TIME_VAL_t;
 #elif defined(CC_TIME_BASE_TYPE_CUSTOM_IS_UINT16)
 #define CC_MAX_TIMEOUT UINT16_MAX
+typedef uint16_t CC_TIME_VAL_t;
 #elif defined(CC_TIME_BASE_TYPE_CUSTOM_IS_UINT32)
 #define CC_MAX_TIMEOUT UINT32_MAX
+typedef uint32_t CC_TIME_VAL_t;
 #elif defined(CC_TIME_BASE_TYPE_CUSTOM_IS_UINT64)
 #define CC_MAX_TIMEOUT UINT64_MAX
+typedef uint64_t CC_TIME_VAL_t;
 #elif defined(CC_TIME_BASE_TYPE_CUSTOM_IS_INT8)
 #define CC_MAX_TIMEOUT INT8_MAX
+typedef int8_t CC_TIME_VAL_t;
 #elif defined(CC_TIME_BASE_TYPE_CUSTOM_IS_INT16)
 #define CC_MAX_TIMEOUT INT16_MAX
+typedef int16_t CC_TIME_VAL_t;
 #elif defined(CC_TIME_BASE_TYPE_CUSTOM_IS_INT32)
 #define CC_MAX_TIMEOUT INT32_MAX
+typedef int32_t CC_TIME_VAL_t;
 #elif defined(CC_TIME_BASE_TYPE_CUSTOM_IS_INT64)
 #define CC_MAX_TIMEOUT INT64_MAX
+typedef int64_t CC_TIME_VAL_t;
 #else
 #error "CC_MAX_TIMEOUT: Unknown CC_TIME_BASE_TYPE_CUSTOM or missing _IS_* define"
 #endif
@@ -111,70 +333,481 @@ typedef enum
     CC_MSG_REG
 } CC_MsgRegStatus_t;
 
+/**
+ * @brief Enumeration of the transmission modes of a TX table entry.
+ *
+ * Values:
+ * - CC_TX_MODE_CYCLIC: The message is sent every `SendFreq` ticks.
+ * - CC_TX_MODE_ON_CHANGE: The payload is checked every `MinInterval` ticks and the message
+ *   is sent if it changed since the last transmission, or if `SendFreq` ticks have passed
+ *   since then (heartbeat). CC_TX_ON_CHANGE only.
+ */
+typedef enum
+{
+    CC_TX_MODE_CYCLIC = 0,
+    CC_TX_MODE_ON_CHANGE
+} CC_TX_mode_t;
+
+/**
+ * @brief Enumeration of the reception modes of an RX table entry.
+ *
+ * Values:
+ * - CC_RX_MODE_QUEUE: Every received frame is queued and parsed.
+ * - CC_RX_MODE_LATEST: Received frames overwrite the entry's mailbox, and only the newest
+ *   one is parsed by the next poll. CC_RX_MAILBOX only.
+ */
+typedef enum
+{
+    CC_RX_MODE_QUEUE = 0,
+    CC_RX_MODE_LATEST
+} CC_RX_mode_t;
+
 /**
  * @brief Structure representing a CAN message stored in the receive buffer.
  *
  * Fields:
  * - ID: CAN message identifier.
- * - Data: CAN message data payload (up to 8 bytes).
- * - DLC: Data Length Code, number of valid data bytes (0-8).
+ * - Data: CAN message data payload (up to 8 bytes, or a pointer to up to 64 bytes
+ *   of per-instance storage with CC_FD_SUPPORT).
+ * - DLC: Data Length Code (0-15), see CC_DlcToLen for the number of valid data bytes.
  * - IDE_flag: Identifier Extension flag (0 = standard, 1 = extended).
+ * - FDF_flag: FD Format flag (0 = classic CAN, 1 = CAN FD), CC_FD_SUPPORT only.
+ * - BRS_flag: Bit Rate Switch flag, CC_FD_SUPPORT only.
+ * - ESI_flag: Error State Indicator flag, CC_FD_SUPPORT only.
  * - Time: Timestamp when the message was received.
+ * - HwTime: Hardware timestamp of the message, CC_RX_HW_TIMESTAMP only.
+ * - Stamp: Cycle count when the message entered the receive buffer, CC_LATENCY only.
  */
 typedef struct
 {
     uint32_t ID;
+#if CC_FD_SUPPORT
+    uint8_t *Data;
+#else
     uint8_t Data[8];
+#endif
     uint8_t DLC : 4;
     uint8_t IDE_flag : 1;
+#if CC_FD_SUPPORT
+    uint8_t FDF_flag : 1;
+    uint8_t BRS_flag : 1;
+    uint8_t ESI_flag : 1;
+#endif
     CC_TIME_t Time;
+#if CC_RX_HW_TIMESTAMP
+    uint64_t HwTime;
+#endif
+#if CC_LATENCY
+    uint32_t Stamp;
+#endif
 } CC_RX_message_t;
 
+#if CC_RX_MAILBOX
+/**
+ * @brief Latest-value mailbox of an RX table entry.
+ *
+ * The producer writes the message under a sequence lock: `Seq` is odd while the
+ * message is being written, and the consumer retries a read that saw it change.
+ * The mailbox holds an unparsed message while `Seq` differs from `Read`, and is in the
+ * dirty mailbox queue of its instance while `Posted` differs from `Drained`.
+ *
+ * Fields:
+ * - Msg: Newest received message. With CC_FD_SUPPORT, `Msg.Data` must be set by the
+ *   caller to storage large enough for the payload of the entry.
+ * - Seq: Write sequence number, owned by the producer.
+ * - Read: Sequence number of the last parsed message, owned by the consumer.
+ * - Posted: Count of insertions into the dirty mailbox queue, owned by the producer.
+ * - Drained: Count of removals from the dirty mailbox queue, owned by the consumer.
+ */
+typedef struct
+{
+    CC_RX_message_t Msg;
+    CC_INDEX_t Seq;
+    CC_INDEX_t Read;
+    CC_INDEX_t Posted;
+    CC_INDEX_t Drained;
+} CC_RX_mailbox_t;
+#endif
+
+/**
+ * @brief Index state of a single-producer single-consumer ring buffer.
+ *
+ * The ring only manages indices; the element storage belongs to the instance
+ * using it, so the same logic serves the RX and TX buffers whatever their
+ * element type and size. One slot is kept free to tell a full ring from an
+ * empty one, so a ring of `Size` slots holds up to `Size - 1` elements.
+ *
+ * Fields:
+ * - Head: Index of the last written slot (producer side).
+ * - Tail: Index of the last consumed slot (consumer side).
+ * - Size: Number of slots in the ring.
+ * - Mask: `Size - 1` if Size is a power of two, otherwise 0.
+ */
+typedef struct
+{
+    CC_INDEX_t Head;
+    CC_INDEX_t Tail;
+    uint16_t Size;
+    uint16_t Mask;
+} CC_ring_t;
+
+#if CC_RX_HW_TIMESTAMP
+/**
+ * @brief State of the 64-bit extension of a wrapping hardware timer.
+ *
+ * Fields:
+ * - Time: Last extended timer value.
+ * - Mask: Mask of the valid bits of the raw timer value.
+ */
+typedef struct
+{
+    uint64_t Time;
+    uint32_t Mask;
+} CC_hwtime_ext_t;
+#endif
+
+/**
+ * @brief Deadline scheduler node.
+ *
+ * Nodes form a binary min-heap ordered by the time remaining until `Start + Period`.
+ * The heap is stored in place, one node per table entry: the entry at position `i`
+ * holds the heap node at position `i`, which may belong to another entry.
+ *
+ * Fields:
+ * - Start: Tick at which the current period started.
+ * - Period: Length of the period in system ticks.
+ * - Idx: Table position of the entry the node belongs to.
+ */
+typedef struct
+{
+    CC_TIME_VAL_t Start;
+    CC_TIME_VAL_t Period;
+    uint16_t Idx;
+} CC_sched_node_t;
+
+/**
+ * @brief Deadline scheduler over the nodes embedded in a message table.
+ *
+ * Fields:
+ * - Base: Address of the node embedded in the first table entry.
+ * - Stride: Size of one table entry in bytes.
+ * - Count: Number of nodes in the heap.
+ * - Ready: Set once the heap has been ordered against the current tick.
+ */
+typedef struct
+{
+    uint8_t *Base;
+    uint16_t Stride;
+    uint16_t Count;
+    uint8_t Ready;
+} CC_sched_t;
+
+#if CC_TRACE
+/**
+ * @brief Record flags of CC_trace_record_t.
+ *
+ * - CC_TRACE_IDE / CC_TRACE_FDF / CC_TRACE_BRS / CC_TRACE_ESI: Frame flags.
+ * - CC_TRACE_TX: The frame was handed to the TX driver (otherwise it was received).
+ * - CC_TRACE_HWTIME: `Time` holds the hardware timestamp instead of the system tick.
+ */
+#define CC_TRACE_IDE 0x01u
+#define CC_TRACE_FDF 0x02u
+#define CC_TRACE_BRS 0x04u
+#define CC_TRACE_ESI 0x08u
+#define CC_TRACE_TX 0x10u
+#define CC_TRACE_HWTIME 0x20u
+
+/**
+ * @brief Fixed-size capture record of one frame.
+ *
+ * 24 bytes without CC_FD_SUPPORT, 80 bytes with it. Payload bytes past the DLC
+ * length are undefined.
+ *
+ * Fields:
+ * - Time: System tick of the frame, or its hardware timestamp (see CC_TRACE_HWTIME).
+ * - ID: CAN message identifier.
+ * - DLC: Data Length Code (0-15).
+ * - Flags: Combination of the CC_TRACE_* record flags.
+ * - Channel: Channel number of the trace ring the record was written to.
+ * - Reserved: Always 0.
+ * - Data: Payload.
+ */
+typedef struct
+{
+    uint64_t Time;
+    uint32_t ID;
+    uint8_t DLC;
+    uint8_t Flags;
+    uint8_t Channel;
+    uint8_t Reserved;
+    uint8_t Data[CC_MAX_DATA_LEN];
+} CC_trace_record_t;
+
+/**
+ * @brief Lock-free ring of capture records.
+ *
+ * Single producer, single consumer: all instances attached to one trace ring must be
+ * fed from the same context (e.g. one ring per RX interrupt and one per TX poll task),
+ * and one context drains it with CC_Trace_Peek/CC_Trace_Release.
+ *
+ * Fields:
+ * - Buf: Record storage (caller-provided).
+ * - Ring: Index state of Buf.
+ * - Channel: Channel number stored in every record.
+ * - Dropped: Records lost because the ring was full, owned by the producer.
+ */
+typedef struct
+{
+    CC_trace_record_t *Buf;
+    CC_ring_t Ring;
+    uint8_t Channel;
+    uint32_t Dropped;
+} CC_trace_t;
+#endif
+
+/**
+ * @brief Statistics of a CAN RX instance (CC_STATS_ENABLE only).
+ *
+ * Fields:
+ * - Pushed: Messages stored in the receive buffer.
+ * - DroppedFull: Messages lost because the receive buffer was full.
+ * - DroppedOversize: Messages lost because the payload exceeded the slot size.
+ * - Unregistered: Messages that matched no table entry.
+ * - Overwritten: Mailbox messages replaced before they were parsed, CC_RX_MAILBOX only.
+ * - Routed: Messages forwarded by at least one route, CC_GATEWAY only.
+ * - HighWater: Highest number of messages held in the receive buffer.
+ */
+typedef struct
+{
+    uint32_t Pushed;
+    uint32_t DroppedFull;
+    uint32_t DroppedOversize;
+    uint32_t Unregistered;
+#if CC_RX_MAILBOX
+    uint32_t Overwritten;
+#endif
+#if CC_GATEWAY
+    uint32_t Routed;
+#endif
+    uint16_t HighWater;
+} CC_RX_stats_t;
+
+#if CC_PROFILE
+/**
+ * @brief Cycle counts of one poll stage (CC_PROFILE only).
+ *
+ * Calls that find no work (an empty buffer, no due entry) are not counted.
+ *
+ * Fields:
+ * - Calls: Number of measured calls.
+ * - Items: Number of items processed by the measured calls (see the stage).
+ * - Cycles: Total cycles spent in the measured calls.
+ * - Max: Highest cycle count of a single call.
+ */
+typedef struct
+{
+    uint32_t Calls;
+    uint32_t Items;
+    uint64_t Cycles;
+    uint32_t Max;
+} CC_profile_t;
+
+/**
+ * @brief Cycle counts of the poll stages of a CAN RX instance (CC_PROFILE only).
+ *
+ * Fields:
+ * - Dispatch: Buffered messages parsed by CC_RX_Poll, Items = messages.
+ * - Timeout: Timeout check of CC_RX_Poll, Items = due table entries visited.
+ */
+typedef struct
+{
+    CC_profile_t Dispatch;
+    CC_profile_t Timeout;
+} CC_RX_profile_t;
+
+/**
+ * @brief Cycle counts of the poll stages of a CAN TX instance (CC_PROFILE only).
+ *
+ * Fields:
+ * - Tables: TX table scan of CC_TX_Poll, Items = due table entries visited.
+ * - Send: Hand-over of queued messages to the driver, Items = messages sent.
+ */
+typedef struct
+{
+    CC_profile_t Tables;
+    CC_profile_t Send;
+} CC_TX_profile_t;
+#endif
+
+#if CC_LATENCY
+/**
+ * @brief Log2 histogram of latency samples in cycles (CC_LATENCY only).
+ *
+ * Fields:
+ * - Bins: Sample counts per bucket, see CC_LATENCY_BINS.
+ * - Max: Longest sample.
+ */
+typedef struct
+{
+    uint32_t Bins[CC_LATENCY_BINS];
+    uint32_t Max;
+} CC_hist_t;
+
+/**
+ * @brief Latency histograms of a CAN RX instance or RX table entry (CC_LATENCY only).
+ *
+ * Fields:
+ * - Wait: Time from entering the receive buffer to dispatch by CC_RX_Poll.
+ * - Parser: Duration of the `Parser` call, or of the registered dispatch function.
+ */
+typedef struct
+{
+    CC_hist_t Wait;
+    CC_hist_t Parser;
+} CC_RX_latency_t;
+#endif
+
 /**
  * @brief Definition of an entry in the CAN receive message table.
  *
  * Fields:
  * - SlotNo: Slot number in the receive table.
  * - ID: CAN message identifier.
- * - DLC: Data Length Code, expected number of data bytes.
+ * - DLC: Data Length Code, expected DLC of the message.
  * - IDE_flag: Identifier Extension flag (0 = standard, 1 = extended).
- * - TimeOut: Timeout duration for this message slot.
+ * - FDF_flag: Expected FD Format flag, CC_FD_SUPPORT only.
+ * - TimeOut: Timeout duration for this message slot, 0 for none. Clearing it at runtime
+ *   stops the supervision of the entry at its next deadline; CC_RX_init must be called
+ *   again to supervise the entry after setting a non-zero value.
  * - Parser: Pointer to message parser callback function.
  * - LastTick: Timestamp of the last received message in this slot.
+ * - LookupIdx: Internal lookup index entry, maintained by CC_RX_init. Entry `i` holds
+ *   the table position of the `i`-th message in (IDE, ID) order.
+ * - Mode: Reception mode, see CC_RX_mode_t. CC_RX_MAILBOX only.
+ * - Mailbox: Latest-value mailbox of a CC_RX_MODE_LATEST entry, provided by the caller.
+ *   CC_RX_MAILBOX only.
+ * - MailboxIdx: Internal dirty mailbox queue entry, maintained by the library. Entry `i`
+ *   holds the table position of the mailbox in queue slot `i`. CC_RX_MAILBOX only.
+ * - Sched: Internal timeout scheduler node, maintained by the library.
+ * - RxCount: Number of messages dispatched to this entry, CC_STATS_ENABLE only.
+ * - TimeoutCount: Number of timeouts reported for this entry, CC_STATS_ENABLE only.
  */
 typedef struct CC_RX_instance_t CC_RX_instance_t;
+typedef struct CC_bus_group_t CC_bus_group_t;
+typedef struct CC_route_t CC_route_t;
+typedef struct CC_RX_hook_t CC_RX_hook_t;
 typedef struct
 {
     uint16_t SlotNo;
     uint32_t ID;
     uint8_t DLC : 4;
     uint8_t IDE_flag : 1;
+#if CC_FD_SUPPORT
+    uint8_t FDF_flag : 1;
+#endif
     CC_TIME_t TimeOut;
     void (*Parser)(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg, uint16_t Slot);
     CC_TIME_t LastTick;
+    uint16_t LookupIdx;
+#if CC_RX_MAILBOX
+    uint8_t Mode;
+    CC_RX_mailbox_t *Mailbox;
+    uint16_t MailboxIdx;
+#endif
+    CC_sched_node_t Sched;
+#if CC_STATS_ENABLE
+    uint32_t RxCount;
+    uint32_t TimeoutCount;
+#endif
 } CC_RX_table_t;
 
 /**
  * @brief CAN receive instance structure.
  *
  * Fields:
- * - Buf: Circular buffer for received CAN messages.
- * - Head: Index of the buffer head (write position).
- * - Tail: Index of the buffer tail (read position).
+ * - Buf: Circular buffer for received CAN messages (caller-provided storage).
+ * - Ring: Index state of Buf.
+ * - PayloadSize: Payload bytes available per slot, CC_FD_SUPPORT only.
  * - RxTable: Pointer to the message registration table.
  * - TableSize: Number of entries in the message table.
  * - Parser_unreg_msg: Callback for unregistered messages.
  * - TimeoutCallback: Callback for message timeout events.
+ * - TimeoutSched: Scheduler of the message timeout deadlines.
+ * - Keys: Optional dense array of the lookup keys in key order, see CC_RX_Keys_init.
+ * - KeyIdx: Optional dense array of the table positions matching Keys.
+ * - Dispatch: Optional table dispatch function replacing the lookup and parser call,
+ *   see CC_RX_dispatch_function_register.
+ * - GetTick: Optional instance tick source; if NULL, the global tick source is used.
+ * - WakeCallback: Optional callback fired by the producer when the instance gets work,
+ *   see CC_RX_Notify_init.
+ * - HighWaterCallback: Optional callback fired by the producer when the buffer fill level
+ *   reaches HighWaterLevel, see CC_RX_Notify_init.
+ * - HighWaterLevel: Buffer fill level that fires HighWaterCallback.
+ * - Hooks: Optional chain of protocol handlers, see CC_RX_Hook_attach.
+ * - Trace: Capture ring of pushed frames, see CC_RX_Trace_attach. CC_TRACE only.
+ * - MailboxCount: Number of CC_RX_MODE_LATEST table entries, CC_RX_MAILBOX only.
+ * - MailboxHead: Write position of the dirty mailbox queue (0 to 2 * MailboxCount - 1),
+ *   owned by the producer. CC_RX_MAILBOX only.
+ * - MailboxTail: Read position of the dirty mailbox queue, owned by the consumer.
+ *   CC_RX_MAILBOX only.
+ * - Routes: Routing table of the instance, see CC_RX_Routes_init. CC_GATEWAY only.
+ * - RouteCount: Number of entries in Routes, CC_GATEWAY only.
+ * - RouteIsr: Number of CC_ROUTE_ISR routes in Routes, CC_GATEWAY only.
+ * - Group: Bus group the instance belongs to, CC_SYNC_C11 only.
+ * - GroupBit: Ready bit of the instance in its bus group, CC_SYNC_C11 only.
+ * - Stats: Statistics counters, CC_STATS_ENABLE only.
+ * - Profile: Cycle counts of the poll stages, CC_PROFILE only.
+ * - Latency: Latency histograms, CC_LATENCY only.
+ * - SlotLatency: Optional per-entry latency histograms, see CC_RX_LatencySlots_attach.
+ *   CC_LATENCY only.
  */
 struct CC_RX_instance_t
 {
-    CC_RX_message_t Buf[CC_RX_BUFFER_SIZE];
-    uint16_t Head;
-    uint16_t Tail;
+    CC_RX_message_t *Buf;
+    CC_ring_t Ring;
+#if CC_FD_SUPPORT
+    uint8_t PayloadSize;
+#endif
     CC_RX_table_t *RxTable;
     uint16_t TableSize;
     void (*Parser_unreg_msg)(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg);
     void (*TimeoutCallback)(CC_RX_instance_t *Instance, uint16_t Slot);
+    CC_sched_t TimeoutSched;
+    uint32_t *Keys;
+    uint16_t *KeyIdx;
+    CC_RX_table_t *(*Dispatch)(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg);
+    CC_TIME_VAL_t (*GetTick)(void);
+    void (*WakeCallback)(CC_RX_instance_t *Instance);
+    void (*HighWaterCallback)(CC_RX_instance_t *Instance, uint16_t Level);
+    uint16_t HighWaterLevel;
+    CC_RX_hook_t *Hooks;
+#if CC_TRACE
+    CC_trace_t *Trace;
+#endif
+#if CC_RX_MAILBOX
+    uint16_t MailboxCount;
+    CC_INDEX_t MailboxHead;
+    CC_INDEX_t MailboxTail;
+#endif
+#if CC_GATEWAY
+    const CC_route_t *Routes;
+    uint16_t RouteCount;
+    uint16_t RouteIsr;
+#endif
+#if CC_SYNC_MODE == CC_SYNC_C11
+    CC_bus_group_t *Group;
+    uint32_t GroupBit;
+#endif
+#if CC_STATS_ENABLE
+    CC_RX_stats_t Stats;
+#endif
+#if CC_PROFILE
+    CC_RX_profile_t Profile;
+#endif
+#if CC_LATENCY
+    CC_RX_latency_t Latency;
+    CC_RX_latency_t *SlotLatency;
+#endif
 };
 
 /**
@@ -182,18 +815,56 @@ struct CC_RX_instance_t
  *
  * Fields:
  * - ID: CAN message identifier.
- * - Data: CAN message data payload (up to 8 bytes).
- * - DLC: Data Length Code: number of valid data bytes (0-8).
+ * - Data: CAN message data payload (up to 8 bytes, or a pointer to up to 64 bytes
+ *   of per-instance storage with CC_FD_SUPPORT).
+ * - DLC: Data Length Code (0-15), see CC_DlcToLen for the number of valid data bytes.
  * - IDE_flag: Identifier Extension flag (0 = standard, 1 = extended).
+ * - FDF_flag: FD Format flag (0 = classic CAN, 1 = CAN FD), CC_FD_SUPPORT only.
+ * - BRS_flag: Bit Rate Switch flag, CC_FD_SUPPORT only.
+ * - Seq: Internal push sequence number, CC_TX_PRIORITY_QUEUE only.
+ * - Stamp: Cycle count when the message entered the transmit buffer, CC_LATENCY only.
  */
 typedef struct
 {
     uint32_t ID;
+#if CC_FD_SUPPORT
+    uint8_t *Data;
+#else
     uint8_t Data[8];
+#endif
     uint8_t DLC : 4;
     uint8_t IDE_flag : 1;
+#if CC_FD_SUPPORT
+    uint8_t FDF_flag : 1;
+    uint8_t BRS_flag : 1;
+#endif
+#if CC_TX_PRIORITY_QUEUE
+    uint16_t Seq;
+#endif
+#if CC_LATENCY
+    uint32_t Stamp;
+#endif
 } CC_TX_message_t;
 
+/**
+ * @brief Statistics of a CAN TX instance (CC_STATS_ENABLE only).
+ *
+ * Fields:
+ * - Pushed: Messages stored in the transmit buffer.
+ * - DroppedFull: Messages lost because the transmit buffer was full.
+ * - DroppedOversize: Messages lost because the payload exceeded the slot size.
+ * - BusBusy: Polls that left messages queued because the bus was busy.
+ * - HighWater: Highest number of messages held in the transmit buffer.
+ */
+typedef struct
+{
+    uint32_t Pushed;
+    uint32_t DroppedFull;
+    uint32_t DroppedOversize;
+    uint32_t BusBusy;
+    uint16_t HighWater;
+} CC_TX_stats_t;
+
 /**
  * @brief Definition of an entry in the CAN transmit message table.
  *
@@ -201,11 +872,23 @@ typedef struct
  * - SlotNo: Slot number in the transmit table.
  * - ID: CAN message identifier.
  * - Data: Pointer to the data buffer to be transmitted.
- * - DLC: Data Length Code: number of valid data bytes.
+ * - DLC: Data Length Code (0-15), see CC_DlcToLen for the number of valid data bytes.
  * - IDE_flag: Identifier Extension flag (0 = standard, 1 = extended).
- * - SendFreq: Frequency at which the message should be sent (in system ticks).
+ * - FDF_flag: FD Format flag, CC_FD_SUPPORT only.
+ * - BRS_flag: Bit Rate Switch flag, CC_FD_SUPPORT only.
+ * - SendFreq: Frequency at which the message should be sent (in system ticks), 0 = every tick.
+ *   A shortened period takes effect after the next transmission of the message.
  * - Parser: Pointer to function that prepares data before sending.
  * - LastTick: Timestamp of the last message transmission.
+ * - Offset: Phase of the message within its period (in system ticks, taken modulo SendFreq).
+ *   Applied once by CC_TX_init: the first transmission happens Offset ticks after LastTick
+ *   instead of one full period after it. See CC_TX_AutoPhase.
+ * - Mode: Transmission mode, see CC_TX_mode_t. CC_TX_ON_CHANGE only.
+ * - MinInterval: Payload check interval of an on-change entry, which is also the shortest
+ *   time between two of its transmissions (in system ticks). CC_TX_ON_CHANGE only.
+ * - Shadow: Copy of the last sent payload of an on-change entry, at least as long as the
+ *   payload. Provided by the caller. CC_TX_ON_CHANGE only.
+ * - Sched: Internal send scheduler node, maintained by the library.
  */
 typedef struct CC_TX_instance_t CC_TX_instance_t;
 typedef struct CC_TX_table_t CC_TX_table_t;
@@ -216,112 +899,611 @@ struct CC_TX_table_t
     uint8_t *Data;
     uint8_t DLC : 4;
     uint8_t IDE_flag : 1;
+#if CC_FD_SUPPORT
+    uint8_t FDF_flag : 1;
+    uint8_t BRS_flag : 1;
+#endif
     CC_TIME_t SendFreq;
     void (*Parser)(const CC_TX_instance_t *Instance, uint8_t *Data, CC_TX_table_t *TxTable);
     CC_TIME_t LastTick;
+    CC_TIME_t Offset;
+#if CC_TX_ON_CHANGE
+    uint8_t Mode;
+    CC_TIME_t MinInterval;
+    uint8_t *Shadow;
+#endif
+    CC_sched_node_t Sched;
 };
 
 /**
  * @brief CAN transmit instance structure.
  *
  * Fields:
- * - Buf: Circular buffer for CAN messages to be transmitted.
- * - Head: Index of the buffer head (write position).
- * - Tail: Index of the buffer tail (read position).
+ * - Buf: Circular buffer for CAN messages to be transmitted (caller-provided storage).
+ * - Ring: Index state of Buf; only `Size` is used in CC_TX_PRIORITY_QUEUE mode.
+ * - PayloadSize: Payload bytes available per slot, CC_FD_SUPPORT only.
+ * - Count: Number of queued messages, CC_TX_PRIORITY_QUEUE only.
+ * - Seq: Sequence number of the next pushed message, CC_TX_PRIORITY_QUEUE only.
  * - TxTable: Pointer to the transmit message registration table.
  * - TableSize: Number of entries in the transmit message table.
+ * - SendSched: Scheduler of the cyclic message deadlines.
  * - SendFunction: Function pointer to the low-level send function.
  * - BusCheck: Function pointer to check if the CAN bus is free.
+ * - FreeSlots: Optional function pointer returning the number of free hardware TX slots.
+ * - SendBatch: Optional function pointer handing several buffered messages to the hardware.
+ * - GetTick: Optional instance tick source; if NULL, the global tick source is used.
+ * - WakeCallback: Optional callback fired when queued messages can be sent, see CC_TX_Notify_init.
+ * - Trace: Capture ring of sent frames, see CC_TX_Trace_attach. CC_TRACE only.
+ * - Stats: Statistics counters, CC_STATS_ENABLE only.
+ * - Profile: Cycle counts of the poll stages, CC_PROFILE only.
+ * - Latency: Histogram of the time from entering the transmit buffer to the hand-over
+ *   to the driver, CC_LATENCY only.
  */
 struct CC_TX_instance_t
 {
-    CC_TX_message_t Buf[CC_TX_BUFFER_SIZE];
-    uint16_t Head;
-    uint16_t Tail;
+    CC_TX_message_t *Buf;
+    CC_ring_t Ring;
+#if CC_FD_SUPPORT
+    uint8_t PayloadSize;
+#endif
+#if CC_TX_PRIORITY_QUEUE
+    uint16_t Count;
+    uint16_t Seq;
+#endif
     CC_TX_table_t *TxTable;
     uint16_t TableSize;
+    CC_sched_t SendSched;
     void (*SendFunction)(const CC_TX_instance_t *Instance, const CC_TX_message_t *msg);
     CC_BusIsFree_t (*BusCheck)(const CC_TX_instance_t *Instance);
+    uint16_t (*FreeSlots)(const CC_TX_instance_t *Instance);
+    uint16_t (*SendBatch)(const CC_TX_instance_t *Instance, const CC_TX_message_t *Msgs, uint16_t Count);
+    CC_TIME_VAL_t (*GetTick)(void);
+    void (*WakeCallback)(CC_TX_instance_t *Instance);
+#if CC_TRACE
+    CC_trace_t *Trace;
+#endif
+#if CC_STATS_ENABLE
+    CC_TX_stats_t Stats;
+#endif
+#if CC_PROFILE
+    CC_TX_profile_t Profile;
+#endif
+#if CC_LATENCY
+    CC_hist_t Latency;
+#endif
 };
 
-#if CC_TICK_FROM_FUNC
+#if CC_GATEWAY
 /**
- * @brief Registers the system tick source function.
+ * @def CC_ROUTE_ISR
+ * @brief Route flag: forward in the pushing context instead of in CC_RX_Poll.
  *
- * When CC_TICK_FROM_FUNC is set to 1, this function registers a user-provided
- * function that returns the current system tick value.
+ * The destination TX instance is then fed from the RX push context, so it must not be
+ * pushed from another context (see CC_SYNC_MODE and CC_TX_PRIORITY_QUEUE).
+ */
+#define CC_ROUTE_ISR 0x01u
+
+/**
+ * @def CC_ROUTE_CONSUME
+ * @brief Route flag: a forwarded frame is not dispatched to the RX table.
  *
- * @param Function Pointer to a function that returns the current system tick (CC_TIME_t).
+ * A frame consumed by a CC_ROUTE_ISR route takes no room in the receive buffer.
  */
-void CC_tick_function_register(CC_TIME_t (*Function)(void));
-#else
+#define CC_ROUTE_CONSUME 0x02u
+
 /**
- * @brief Registers the system tick source variable.
+ * @brief Entry of the gateway routing table of an RX instance.
  *
- * When CC_TICK_FROM_FUNC is set to 0, this function registers a pointer
- * to a variable that holds the current system tick value.
+ * A frame matches a route if its IDE flag equals `IDE_flag` and `(FrameID & Mask) == ID`.
+ * Every matching route forwards its own copy, so a frame can be sent to several
+ * destinations by listing several routes.
  *
- * @param Variable Pointer to a volatile variable of type CC_TIME_t representing the system tick.
+ * Fields:
+ * - ID: Match identifier, already masked.
+ * - Mask: Match mask (1 = bit must match).
+ * - IDE_flag: Identifier Extension flag (0 = standard, 1 = extended).
+ * - Flags: Combination of CC_ROUTE_ISR and CC_ROUTE_CONSUME.
+ * - RewriteMask: Identifier bits replaced on forwarding, 0 = keep the identifier.
+ * - RewriteID: Values of the replaced identifier bits.
+ * - Dest: Destination TX instance.
+ * - Transform: Optional hook run on the destination slot before it is queued. It may
+ *   change the ID and payload in place; returning 0 drops the copy.
  */
-void CC_tick_variable_register(CC_TIME_t *Variable);
+struct CC_route_t
+{
+    uint32_t ID;
+    uint32_t Mask;
+    uint8_t IDE_flag;
+    uint8_t Flags;
+    uint32_t RewriteMask;
+    uint32_t RewriteID;
+    CC_TX_instance_t *Dest;
+    uint8_t (*Transform)(const CC_route_t *Route, CC_TX_message_t *Msg);
+};
 #endif
 
 /**
- * @brief Initializes the CAN RX instance.
+ * @brief Protocol handler attached to an RX instance.
  *
- * Sets up the receive buffer, message registration table, and callback functions.
+ * Handlers see every queued frame during CC_RX_Poll, before the RX table lookup,
+ * so a transport protocol can take frames whose DLC varies from frame to frame.
+ * A handler is usually embedded as the first member of the protocol's own state,
+ * which it gets back from the `Hook` pointer.
  *
- * @param Instance Pointer to the RX instance to initialize.
+ * Fields:
+ * - Handler: Called with each frame; returns non-zero if it consumed the frame,
+ *   which then skips the other handlers and the RX table.
+ * - Next: Next handler of the chain, maintained by CC_RX_Hook_attach.
+ */
+struct CC_RX_hook_t
+{
+    uint8_t (*Handler)(CC_RX_hook_t *Hook, const CC_RX_instance_t *Instance, CC_RX_message_t *Msg);
+    CC_RX_hook_t *Next;
+};
+
+/**
+ * @brief Group of RX and TX instances polled together.
+ *
+ * A bus group reads the global tick once per pass and polls all its instances.
+ * The pass only dispatches the RX instances that received messages; timeouts are
+ * checked for every instance. With CC_SYNC_C11, every push into a grouped RX
+ * instance sets the instance's bit in `Ready`, which the pass takes in one atomic
+ * exchange. In the other sync modes, which have no atomic read-modify-write shared
+ * with interrupt handlers, each instance's buffer and mailbox queue indices are
+ * compared instead.
+ *
+ * Fields:
+ * - Rx: Array of pointers to the RX instances of the group.
+ * - RxCount: Number of RX instances (at most 32).
+ * - Tx: Array of pointers to the TX instances of the group.
+ * - TxCount: Number of TX instances.
+ * - Ready: Bitmask of RX instances with pending messages, CC_SYNC_C11 only.
+ */
+struct CC_bus_group_t
+{
+    CC_RX_instance_t **Rx;
+    uint8_t RxCount;
+    CC_TX_instance_t **Tx;
+    uint8_t TxCount;
+#if CC_SYNC_MODE == CC_SYNC_C11
+    _Atomic uint32_t Ready;
+#endif
+};
+
+#if CC_TICK_FROM_FUNC
+/**
+ * @brief Registers the system tick source function.
+ *
+ * When CC_TICK_FROM_FUNC is set to 1, this function registers a user-provided
+ * function that returns the current system tick value.
+ *
+ * @param Function Pointer to a function that returns the current system tick (CC_TIME_t).
+ */
+void CC_tick_function_register(CC_TIME_t (*Function)(void));
+#else
+/**
+ * @brief Registers the system tick source variable.
+ *
+ * When CC_TICK_FROM_FUNC is set to 0, this function registers a pointer
+ * to a variable that holds the current system tick value.
+ *
+ * @param Variable Pointer to a volatile variable of type CC_TIME_t representing the system tick.
+ */
+void CC_tick_variable_register(CC_TIME_t *Variable);
+#endif
+
+/**
+ * @brief Converts a DLC code to the number of payload bytes.
+ *
+ * Classic CAN codes 9-15 map to 8 bytes. CAN FD codes 9-15 map to
+ * 12, 16, 20, 24, 32, 48 and 64 bytes.
+ *
+ * @param DLC Data Length Code (0-15).
+ * @param FDF_flag FD Format flag (0 = classic CAN, 1 = CAN FD).
+ * @return uint8_t Number of payload bytes.
+ */
+uint8_t CC_DlcToLen(uint8_t DLC, uint8_t FDF_flag);
+
+/**
+ * @brief Converts a payload length to the smallest DLC code that can hold it.
+ *
+ * @param Len Number of payload bytes (0-64).
+ * @return uint8_t Data Length Code (0-15).
+ */
+uint8_t CC_LenToDlc(uint8_t Len);
+
+/**
+ * @brief Initializes the CAN RX instance.
+ *
+ * Sets up the receive buffer, message registration table, and callback functions.
+ * The receive buffer is provided by the caller, so each instance can be sized for
+ * the traffic of its bus. One slot is kept free to tell a full ring from an empty
+ * one, so the buffer holds up to `BufSize - 1` messages. Power-of-two sizes use
+ * cheaper index arithmetic.
+ *
+ * Builds a sorted lookup index over the table, so message dispatch costs O(log n).
+ * The table itself is not reordered. Call it again if `ID` or `IDE_flag` of any
+ * table entry changes at runtime.
+ *
+ * Entries with a non-zero `TimeOut` are scheduled for timeout supervision here,
+ * so only entries due to expire are visited by CC_RX_Poll. An entry whose `TimeOut`
+ * is zero at init is never supervised, and an entry whose `TimeOut` is cleared later
+ * leaves supervision until the next CC_RX_init.
+ *
+ * With CC_RX_MAILBOX, the mailboxes of CC_RX_MODE_LATEST entries are cleared here;
+ * `Mode` must not change afterwards.
+ *
+ * @param Instance Pointer to the RX instance to initialize.
+ * @param Buf Pointer to the storage of the receive buffer.
+ * @param BufSize Number of messages in Buf (at least 2).
  * @param RxTable Pointer to the array of registered RX messages.
  * @param TableSize Number of entries in the RxTable.
  * @param Parser_unreg_msg Pointer to function called when an unregistered message is received.
  * @param TimeoutCallback Pointer to function called when a registered message times out.
  */
-void CC_RX_init(CC_RX_instance_t *Instance, CC_RX_table_t *RxTable, uint16_t TableSize,
+void CC_RX_init(CC_RX_instance_t *Instance, CC_RX_message_t *Buf, uint16_t BufSize, CC_RX_table_t *RxTable,
+                uint16_t TableSize,
                 void (*Parser_unreg_msg)(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg),
                 void (*TimeoutCallback)(CC_RX_instance_t *Instance, uint16_t Slot));
 
+#if CC_FD_SUPPORT
+/**
+ * @brief Registers the payload storage of a CAN RX instance.
+ *
+ * Must be called after CC_RX_init. The storage holds `PayloadSize` bytes for each
+ * of the instance's buffer slots, so it must be at least `BufSize * PayloadSize`
+ * bytes long. Use 8 for classic CAN buses and 64 for CAN FD buses; frames longer
+ * than PayloadSize are dropped.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Payload Pointer to the payload storage.
+ * @param PayloadSize Payload bytes per slot (8-64).
+ */
+void CC_RX_FD_init(CC_RX_instance_t *Instance, uint8_t *Payload, uint8_t PayloadSize);
+
+/**
+ * @brief Pushes a raw CAN FD message into the RX instance buffer.
+ *
+ * Same as CC_RX_PushMsg, for frames received in FD format.
+ *
+ * @param Instance Pointer to the RX instance to receive the message.
+ * @param ID The CAN message identifier.
+ * @param Data Pointer to the CAN message data bytes (up to 64 bytes).
+ * @param DLC Data Length Code (0-15).
+ * @param IDE_flag Identifier Extension flag (0 = standard ID, 1 = extended ID).
+ * @param BRS_flag Bit Rate Switch flag.
+ * @param ESI_flag Error State Indicator flag.
+ */
+void CC_RX_PushMsgFD(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                     uint8_t BRS_flag, uint8_t ESI_flag);
+#endif
+
+/**
+ * @brief Attaches a structure-of-arrays copy of the RX table match keys.
+ *
+ * Must be called after CC_RX_init. Fills `Keys` with the packed (IDE, ID) key of every
+ * table entry in key order and `KeyIdx` with the matching table positions, so the
+ * message lookup searches two dense arrays instead of loading whole table entries.
+ * Worth it for large tables on cached cores; the table itself is left unchanged.
+ * The arrays must be refilled if the ID or IDE_flag of an entry changes.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Keys Pointer to an array of `TableSize` keys.
+ * @param KeyIdx Pointer to an array of `TableSize` table positions.
+ */
+void CC_RX_Keys_init(CC_RX_instance_t *Instance, uint32_t *Keys, uint16_t *KeyIdx);
+
+/**
+ * @brief Registers a dispatch function for the RX table of an instance.
+ *
+ * The function replaces the table lookup and the `Parser` call of CC_RX_Poll: it
+ * must call the parser of the entry matching the message and return that entry, or
+ * return NULL for an unregistered message. The library still updates `LastTick` and
+ * the statistics of the returned entry. Intended for the switch-based dispatch
+ * generated by CC_RX_TABLE_DEFINE (see can_table_gen.h). Passing NULL restores the
+ * table lookup.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Function Pointer to the dispatch function.
+ */
+void CC_RX_dispatch_function_register(CC_RX_instance_t *Instance,
+                                      CC_RX_table_t *(*Function)(const CC_RX_instance_t *Instance,
+                                                                 CC_RX_message_t *Msg));
+
+/**
+ * @brief Attaches a protocol handler to an RX instance.
+ *
+ * Must be called after CC_RX_init. Handlers are called in attach order, from the
+ * context of CC_RX_Poll; frames consumed by a handler are not counted as unregistered.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Hook Pointer to the handler, with `Handler` set. Kept by reference.
+ */
+void CC_RX_Hook_attach(CC_RX_instance_t *Instance, CC_RX_hook_t *Hook);
+
+/**
+ * @brief Registers the wakeup callbacks of an RX instance.
+ *
+ * For RTOS ports that block the polling task on a semaphore instead of calling
+ * CC_RX_Poll continuously. Both callbacks run in the pushing context (usually the
+ * CAN RX interrupt), so they must be interrupt safe and short, e.g. a semaphore give.
+ * - Wake fires when the receive buffer goes from empty to non-empty, and when a
+ *   CC_RX_MODE_LATEST mailbox is written while all mailboxes were parsed.
+ * - HighWater fires when a push brings the buffer fill level to `HighWaterLevel`
+ *   or above from below it, e.g. to raise the priority of the polling task.
+ *
+ * Must be called after CC_RX_init. Passing NULL disables a callback.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Wake Pointer to the wakeup callback, or NULL.
+ * @param HighWater Pointer to the high-water callback, or NULL. Receives the fill level.
+ * @param HighWaterLevel Fill level firing HighWater (1 to BufSize - 1).
+ */
+void CC_RX_Notify_init(CC_RX_instance_t *Instance, void (*Wake)(CC_RX_instance_t *Instance),
+                       void (*HighWater)(CC_RX_instance_t *Instance, uint16_t Level), uint16_t HighWaterLevel);
+
+#if CC_GATEWAY
+/**
+ * @brief Attaches a gateway routing table to an RX instance.
+ *
+ * Must be called after CC_RX_init. The table is kept by reference. Frames forwarded
+ * by CC_ROUTE_ISR routes are copied into the destination buffers by the push call;
+ * the other routes forward from the receive buffer during CC_RX_Poll, before the
+ * frame is dispatched. Routes are checked in table order.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Routes Pointer to the routing table, or NULL to remove it.
+ * @param RouteCount Number of entries in Routes.
+ */
+void CC_RX_Routes_init(CC_RX_instance_t *Instance, const CC_route_t *Routes, uint16_t RouteCount);
+#endif
+
+/**
+ * @brief Reserves the next free slot of the RX instance buffer for zero-copy reception.
+ *
+ * The driver writes the frame (ID, DLC, IDE_flag, Data) straight into the returned
+ * slot, e.g. from the hardware mailbox or by DMA, and then calls CC_RX_Commit.
+ * The slot's `Time` field is preset to the current system tick and may be overwritten
+ * with a driver timestamp. Same producer rules as CC_RX_PushMsg apply.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @return CC_RX_message_t* Pointer to the reserved slot, or NULL if the buffer is full.
+ */
+CC_RX_message_t *CC_RX_Reserve(CC_RX_instance_t *Instance);
+
+/**
+ * @brief Publishes the slot returned by the last successful CC_RX_Reserve call.
+ *
+ * With CC_RX_MAILBOX, a frame of a CC_RX_MODE_LATEST entry is moved to the entry's
+ * mailbox instead, and the slot stays free.
+ *
+ * @param Instance Pointer to the RX instance.
+ */
+void CC_RX_Commit(CC_RX_instance_t *Instance);
+
 /**
  * @brief Pushes a raw CAN message into the RX instance buffer.
  *
  * This function should be called from the low-level CAN driver when
  * a raw CAN frame is received. It stores the message into the receive buffer
- * of the specified instance.
+ * of the specified instance. It may run in interrupt context concurrently with
+ * CC_RX_Poll, as long as a single context pushes into a given instance
+ * (see CC_SYNC_MODE).
  *
  * @param Instance Pointer to the RX instance to receive the message.
  * @param ID The CAN message identifier.
  * @param Data Pointer to the CAN message data bytes (up to 8 bytes).
- * @param DLC Data Length Code - number of valid bytes in Data.
+ * @param DLC Data Length Code (0-15), see CC_DlcToLen.
  * @param IDE_flag Identifier Extension flag (0 = standard ID, 1 = extended ID).
  */
 void CC_RX_PushMsg(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag);
 
+#if CC_RX_HW_TIMESTAMP
+/**
+ * @brief Pushes a raw CAN message with its hardware timestamp into the RX instance buffer.
+ *
+ * Same as CC_RX_PushMsg; the message additionally carries `HwTime`.
+ *
+ * @param Instance Pointer to the RX instance to receive the message.
+ * @param ID The CAN message identifier.
+ * @param Data Pointer to the CAN message data bytes (up to 8 bytes).
+ * @param DLC Data Length Code (0-15), see CC_DlcToLen.
+ * @param IDE_flag Identifier Extension flag (0 = standard ID, 1 = extended ID).
+ * @param HwTime Hardware timestamp of the message.
+ */
+void CC_RX_PushMsgTs(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                     uint64_t HwTime);
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Pushes a raw CAN FD message with its hardware timestamp into the RX instance buffer.
+ *
+ * @param Instance Pointer to the RX instance to receive the message.
+ * @param ID The CAN message identifier.
+ * @param Data Pointer to the CAN message data bytes (up to 64 bytes).
+ * @param DLC Data Length Code (0-15).
+ * @param IDE_flag Identifier Extension flag (0 = standard ID, 1 = extended ID).
+ * @param BRS_flag Bit Rate Switch flag.
+ * @param ESI_flag Error State Indicator flag.
+ * @param HwTime Hardware timestamp of the message.
+ */
+void CC_RX_PushMsgFDTs(CC_RX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                       uint8_t BRS_flag, uint8_t ESI_flag, uint64_t HwTime);
+#endif
+
+/**
+ * @brief Initializes the 64-bit extension of a wrapping hardware timer.
+ *
+ * @param Ext Pointer to the extension state.
+ * @param Bits Width of the hardware timer in bits (1-32), e.g. 16 for FDCAN timestamps.
+ */
+void CC_HwTime_ExtInit(CC_hwtime_ext_t *Ext, uint8_t Bits);
+
+/**
+ * @brief Extends a raw hardware timer value to a 64-bit monotonic time.
+ *
+ * Must be called at least once per timer wrap period, e.g. for every received frame
+ * and from a periodic task, and from a single context per extension state.
+ *
+ * @param Ext Pointer to the extension state.
+ * @param Raw Raw timer value.
+ * @return uint64_t Monotonic 64-bit timer value.
+ */
+uint64_t CC_HwTime_Extend(CC_hwtime_ext_t *Ext, uint32_t Raw);
+#endif
+
+/**
+ * @brief Pushes a burst of raw CAN messages into the RX instance buffer.
+ *
+ * Intended for drivers that drain several hardware FIFO entries (or receive
+ * several frames per syscall) at once. The ring state is checked once for the
+ * whole burst and the accepted frames are published together. Same producer
+ * rules as CC_RX_PushMsg apply.
+ *
+ * @param Instance Pointer to the RX instance to receive the messages.
+ * @param Msgs Pointer to the array of received frames.
+ * @param Count Number of frames in Msgs.
+ * @param UseMsgTime If non-zero, the `Time` field of each frame is kept, which allows
+ *        per-frame hardware timestamps; otherwise one system tick read is shared by the burst.
+ * @return uint16_t Number of frames accepted. Frames beyond free space are dropped from the end.
+ */
+uint16_t CC_RX_PushMsgBatch(CC_RX_instance_t *Instance, const CC_RX_message_t *Msgs, uint16_t Count,
+                            uint8_t UseMsgTime);
+
+/**
+ * @brief Returns the number of messages that can still be pushed to the receive buffer.
+ *
+ * Frames taken by ISR routes or mailboxes need no buffer slot, so more frames may
+ * actually be accepted. Must be called from the pushing context.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @return uint16_t Number of free receive buffer slots.
+ */
+uint16_t CC_RX_FreeCount(CC_RX_instance_t *Instance);
+
 /**
  * @brief Processes received CAN messages for a given RX instance.
  *
  * This function should be called repeatedly in the main loop.
  * It processes messages in the RX buffer, calls appropriate parsers
  * for registered messages, and handles unregistered messages and timeouts.
+ * With CC_RX_MAILBOX, each mailbox updated since the previous poll is parsed once,
+ * after the queued messages.
  *
  * @param Instance Pointer to the RX instance to be processed.
  */
 void CC_RX_Poll(CC_RX_instance_t *Instance);
 
+/**
+ * @brief Returns the time until an RX instance needs the next CC_RX_Poll call.
+ *
+ * Lets an RTOS task block on its wakeup semaphore (see CC_RX_Notify_init) with an
+ * exact timeout instead of polling continuously. The earliest timeout node may be due
+ * earlier than its entry, because receptions do not move it, so the result never
+ * exceeds the real time to the next timeout. Must be called from the same context
+ * as CC_RX_Poll.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @return CC_TIME_VAL_t System ticks until the next timeout check, 0 if messages are
+ *         waiting or a timeout is due, or CC_MAX_TIMEOUT if no entry is supervised.
+ */
+CC_TIME_VAL_t CC_RX_NextEvent(CC_RX_instance_t *Instance);
+
+/**
+ * @brief Returns the oldest unread message of the RX instance buffer without copying it.
+ *
+ * Allows the consumer to process a message in place instead of through CC_RX_Poll.
+ * The slot is not overwritten by the producer until CC_RX_Release is called.
+ * Must be called from the same context as CC_RX_Poll.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @return CC_RX_message_t* Pointer to the message slot, or NULL if the buffer is empty.
+ */
+CC_RX_message_t *CC_RX_Peek(CC_RX_instance_t *Instance);
+
+/**
+ * @brief Releases the message returned by the last successful CC_RX_Peek call.
+ *
+ * @param Instance Pointer to the RX instance.
+ */
+void CC_RX_Release(CC_RX_instance_t *Instance);
+
 /**
  * @brief Initializes the CAN TX instance.
  *
  * Sets up the transmit buffer, message registration table, and required callbacks.
+ * The transmit buffer is provided by the caller and holds up to `BufSize - 1`
+ * messages. Power-of-two sizes use cheaper index arithmetic.
  *
  * @param Instance Pointer to the TX instance to initialize.
+ * @param Buf Pointer to the storage of the transmit buffer.
+ * @param BufSize Number of messages in Buf (at least 2).
  * @param TxTable Pointer to the array of registered TX messages.
  * @param TableSize Number of entries in the TxTable.
  * @param SendFunction Pointer to function responsible for sending a CAN message.
  * @param BusCheck Pointer to function that checks if the CAN bus is free for transmission.
  */
-void CC_TX_init(CC_TX_instance_t *Instance, CC_TX_table_t *TxTable, uint16_t TableSize,
+void CC_TX_init(CC_TX_instance_t *Instance, CC_TX_message_t *Buf, uint16_t BufSize, CC_TX_table_t *TxTable,
+                uint16_t TableSize,
                 void (*SendFunction)(const CC_TX_instance_t *Instance, const CC_TX_message_t *msg),
                 CC_BusIsFree_t (*BusCheck)(const CC_TX_instance_t *Instance));
 
+/**
+ * @brief Spreads the cyclic messages of a TX table evenly across their periods.
+ *
+ * Fills the `Offset` field of every entry so that messages which would otherwise
+ * become due at the same instant, at startup or at every common multiple of their
+ * periods, are sent in different phases. Entries are placed from the shortest period
+ * up, each into the least loaded of CC_TX_PHASE_BINS bins spanning the shortest
+ * period. Must be called before CC_TX_init; existing offsets are overwritten.
+ *
+ * @param TxTable Pointer to the array of registered TX messages.
+ * @param TableSize Number of entries in the TxTable.
+ */
+void CC_TX_AutoPhase(CC_TX_table_t *TxTable, uint16_t TableSize);
+
+/**
+ * @brief Registers the multi-mailbox callbacks of a CAN TX instance.
+ *
+ * Must be called after CC_TX_init. Once registered, CC_TX_Poll asks FreeSlots how
+ * many hardware TX mailboxes or FIFO entries are free and hands over up to that
+ * many messages in one pass instead of calling BusCheck once per frame.
+ * SendBatch receives messages that are contiguous in the transmit buffer and
+ * returns how many of them were accepted; if NULL, SendFunction is called for each
+ * frame instead. Passing NULL as FreeSlots restores the per-frame BusCheck path.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @param FreeSlots Pointer to function returning the number of free hardware TX slots.
+ * @param SendBatch Pointer to function sending `Count` messages, or NULL.
+ */
+void CC_TX_Batch_init(CC_TX_instance_t *Instance, uint16_t (*FreeSlots)(const CC_TX_instance_t *Instance),
+                      uint16_t (*SendBatch)(const CC_TX_instance_t *Instance, const CC_TX_message_t *Msgs,
+                                            uint16_t Count));
+
+/**
+ * @brief Registers the wakeup callback of a TX instance.
+ *
+ * Wake fires when a push makes the transmit buffer non-empty, and from
+ * CC_TX_MailboxFree while messages are waiting in the buffer. It runs in the calling
+ * context (the pushing task or the TX interrupt), so it must be interrupt safe.
+ * Must be called after CC_TX_init. Passing NULL disables the callback.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @param Wake Pointer to the wakeup callback, or NULL.
+ */
+void CC_TX_Notify_init(CC_TX_instance_t *Instance, void (*Wake)(CC_TX_instance_t *Instance));
+
+/**
+ * @brief Reports that a hardware TX mailbox of the instance became free.
+ *
+ * Intended for the driver's TX complete interrupt. Fires the wakeup callback if
+ * messages are waiting in the transmit buffer, so a task blocked on the bus being
+ * busy can resume sending. Does nothing without a registered callback.
+ *
+ * @param Instance Pointer to the TX instance.
+ */
+void CC_TX_MailboxFree(CC_TX_instance_t *Instance);
+
 /**
  * @brief Asynchronously pushes a CAN message to the transmit buffer.
  *
@@ -332,11 +1514,57 @@ void CC_TX_init(CC_TX_instance_t *Instance, CC_TX_table_t *TxTable, uint16_t Tab
  * @param Instance Pointer to the TX instance where the message will be queued.
  * @param ID The CAN message identifier.
  * @param Data Pointer to the data bytes (up to 8 bytes) to be sent.
- * @param DLC Data Length Code - number of valid bytes in Data.
+ * @param DLC Data Length Code (0-15), see CC_DlcToLen.
  * @param IDE_flag Identifier Extension flag (0 = standard ID, 1 = extended ID).
  */
 void CC_TX_PushMsg(CC_TX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag);
 
+/**
+ * @brief Returns the number of messages that can still be pushed to the transmit buffer.
+ *
+ * Lets a producer pace its pushes instead of overflowing the buffer. Must be called
+ * from the pushing context.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @return uint16_t Number of free transmit buffer slots.
+ */
+uint16_t CC_TX_FreeCount(CC_TX_instance_t *Instance);
+
+/**
+ * @brief Reads the tick source of a TX instance.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @return CC_TIME_VAL_t Instance tick, or the global tick if the instance has no tick source.
+ */
+CC_TIME_VAL_t CC_TX_TickGet(const CC_TX_instance_t *Instance);
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Registers the payload storage of a CAN TX instance.
+ *
+ * Must be called after CC_TX_init. The storage must be at least
+ * `BufSize * PayloadSize` bytes long; frames longer than PayloadSize are dropped.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @param Payload Pointer to the payload storage.
+ * @param PayloadSize Payload bytes per slot (8-64).
+ */
+void CC_TX_FD_init(CC_TX_instance_t *Instance, uint8_t *Payload, uint8_t PayloadSize);
+
+/**
+ * @brief Asynchronously pushes a CAN FD message to the transmit buffer.
+ *
+ * @param Instance Pointer to the TX instance where the message will be queued.
+ * @param ID The CAN message identifier.
+ * @param Data Pointer to the data bytes (up to 64 bytes) to be sent.
+ * @param DLC Data Length Code (0-15).
+ * @param IDE_flag Identifier Extension flag (0 = standard ID, 1 = extended ID).
+ * @param BRS_flag Bit Rate Switch flag.
+ */
+void CC_TX_PushMsgFD(CC_TX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag,
+                     uint8_t BRS_flag);
+#endif
+
 /**
  * @brief Processes the transmit buffer and sends CAN messages when the bus is free.
  *
@@ -347,4 +1575,283 @@ void CC_TX_PushMsg(CC_TX_instance_t *Instance, uint32_t ID, uint8_t *Data, uint8
  */
 void CC_TX_Poll(CC_TX_instance_t *Instance);
 
+/**
+ * @brief Returns the time until the next cyclic message of a TX instance is due.
+ *
+ * Lets an RTOS task sleep until the next deadline instead of polling continuously.
+ * Frames already waiting in the transmit buffer are not taken into account; they
+ * are sent by the next CC_TX_Poll call once the bus is free, which the driver can
+ * signal with CC_TX_MailboxFree.
+ * Must be called from the same context as CC_TX_Poll.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @return CC_TIME_VAL_t System ticks until the next deadline, 0 if a message is due,
+ *         or CC_MAX_TIMEOUT if the TX table is empty.
+ */
+CC_TIME_VAL_t CC_TX_NextEvent(CC_TX_instance_t *Instance);
+
+/**
+ * @brief Registers a tick source of a single RX instance.
+ *
+ * For buses clocked from a different timer than the global tick source. The
+ * instance's message timestamps and timeouts then use this source. Passing NULL
+ * restores the global tick source.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Function Pointer to a function that returns the instance tick (CC_TIME_VAL_t).
+ */
+void CC_RX_tick_function_register(CC_RX_instance_t *Instance, CC_TIME_VAL_t (*Function)(void));
+
+/**
+ * @brief Registers a tick source of a single TX instance.
+ *
+ * The instance's cyclic message scheduling then uses this source. Passing NULL
+ * restores the global tick source.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @param Function Pointer to a function that returns the instance tick (CC_TIME_VAL_t).
+ */
+void CC_TX_tick_function_register(CC_TX_instance_t *Instance, CC_TIME_VAL_t (*Function)(void));
+
+/**
+ * @brief Initializes a bus group.
+ *
+ * Must be called after the instances are initialized. The instance pointer arrays
+ * are kept by reference. An RX instance may belong to one group only.
+ *
+ * @param Group Pointer to the bus group.
+ * @param Rx Array of pointers to RX instances, or NULL.
+ * @param RxCount Number of RX instances (at most 32).
+ * @param Tx Array of pointers to TX instances, or NULL.
+ * @param TxCount Number of TX instances.
+ */
+void CC_Group_init(CC_bus_group_t *Group, CC_RX_instance_t **Rx, uint8_t RxCount, CC_TX_instance_t **Tx,
+                   uint8_t TxCount);
+
+/**
+ * @brief Polls all instances of a bus group in one pass.
+ *
+ * Equivalent to calling CC_RX_Poll and CC_TX_Poll for every instance of the group,
+ * with a single read of the global tick source shared by all instances that have
+ * no tick source of their own.
+ *
+ * @param Group Pointer to the bus group.
+ */
+void CC_Group_Poll(CC_bus_group_t *Group);
+
+/**
+ * @brief Returns the time until a bus group needs the next CC_Group_Poll call.
+ *
+ * The smallest CC_RX_NextEvent and CC_TX_NextEvent result over the instances of
+ * the group. Must be called from the same context as CC_Group_Poll.
+ *
+ * @param Group Pointer to the bus group.
+ * @return CC_TIME_VAL_t System ticks until the next event, 0 if work is pending,
+ *         or CC_MAX_TIMEOUT if nothing is scheduled.
+ */
+CC_TIME_VAL_t CC_Group_NextEvent(CC_bus_group_t *Group);
+
+#if CC_TRACE
+/**
+ * @brief Initializes a trace ring.
+ *
+ * @param Trace Pointer to the trace ring.
+ * @param Buf Pointer to the record storage.
+ * @param Size Number of records in Buf (at least 2); holds up to `Size - 1` records.
+ * @param Channel Channel number stored in the records, e.g. the bus number.
+ */
+void CC_Trace_init(CC_trace_t *Trace, CC_trace_record_t *Buf, uint16_t Size, uint8_t Channel);
+
+/**
+ * @brief Attaches a trace ring to an RX instance.
+ *
+ * Captures every frame pushed into the instance, in the pushing context, before it
+ * is routed, stored in a mailbox or dropped. Must be called after CC_RX_init.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Trace Pointer to the trace ring, or NULL to stop capturing.
+ */
+void CC_RX_Trace_attach(CC_RX_instance_t *Instance, CC_trace_t *Trace);
+
+/**
+ * @brief Attaches a trace ring to a TX instance.
+ *
+ * Captures every frame accepted by the TX driver, in the context of CC_TX_Poll.
+ * Must be called after CC_TX_init.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @param Trace Pointer to the trace ring, or NULL to stop capturing.
+ */
+void CC_TX_Trace_attach(CC_TX_instance_t *Instance, CC_trace_t *Trace);
+
+/**
+ * @brief Returns the oldest captured records as one contiguous run.
+ *
+ * The run can be written to flash, an SD card or a file as is; call
+ * CC_Trace_Release once it has been written.
+ *
+ * @param Trace Pointer to the trace ring.
+ * @param Records Pointer receiving the address of the first record of the run.
+ * @return uint16_t Number of records in the run, 0 if the ring is empty.
+ */
+uint16_t CC_Trace_Peek(CC_trace_t *Trace, const CC_trace_record_t **Records);
+
+/**
+ * @brief Releases the first `Count` records returned by CC_Trace_Peek.
+ *
+ * @param Trace Pointer to the trace ring.
+ * @param Count Number of records to release.
+ */
+void CC_Trace_Release(CC_trace_t *Trace, uint16_t Count);
+#endif
+
+#if CC_STATS_ENABLE
+/**
+ * @brief Takes a snapshot of the statistics of a CAN RX instance.
+ *
+ * Counters updated from interrupt context may advance while the snapshot is taken,
+ * so fields are individually, not mutually, consistent.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Stats Pointer to the structure receiving the snapshot.
+ */
+void CC_RX_StatsGet(const CC_RX_instance_t *Instance, CC_RX_stats_t *Stats);
+
+/**
+ * @brief Clears the statistics of a CAN RX instance, including per-entry counters.
+ *
+ * @param Instance Pointer to the RX instance.
+ */
+void CC_RX_StatsReset(CC_RX_instance_t *Instance);
+
+/**
+ * @brief Takes a snapshot of the statistics of a CAN TX instance.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @param Stats Pointer to the structure receiving the snapshot.
+ */
+void CC_TX_StatsGet(const CC_TX_instance_t *Instance, CC_TX_stats_t *Stats);
+
+/**
+ * @brief Clears the statistics of a CAN TX instance.
+ *
+ * @param Instance Pointer to the TX instance.
+ */
+void CC_TX_StatsReset(CC_TX_instance_t *Instance);
+#endif
+
+#if CC_PROFILE || CC_LATENCY
+/**
+ * @brief Registers the cycle counter read by the poll stages and latency stamps.
+ *
+ * Until a counter is registered, everything is measured as 0 cycles.
+ *
+ * @param Function Pointer to a function returning a free-running 32-bit cycle count.
+ */
+void CC_cycle_function_register(uint32_t (*Function)(void));
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+/**
+ * @brief Enables the DWT cycle counter and registers it as the cycle counter.
+ *
+ * Available on Cortex-M3/M4/M7/M33. The counter runs at the core clock and wraps
+ * after 2^32 cycles, which bounds the longest measurable call.
+ */
+void CC_DWT_init(void);
+#endif
+#endif
+
+#if CC_PROFILE
+/**
+ * @brief Takes a snapshot of the cycle counts of a CAN RX instance.
+ *
+ * Must be called from the polling context of the instance.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Profile Pointer to the structure receiving the snapshot.
+ */
+void CC_RX_ProfileGet(const CC_RX_instance_t *Instance, CC_RX_profile_t *Profile);
+
+/**
+ * @brief Clears the cycle counts of a CAN RX instance.
+ *
+ * @param Instance Pointer to the RX instance.
+ */
+void CC_RX_ProfileReset(CC_RX_instance_t *Instance);
+
+/**
+ * @brief Takes a snapshot of the cycle counts of a CAN TX instance.
+ *
+ * Must be called from the polling context of the instance.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @param Profile Pointer to the structure receiving the snapshot.
+ */
+void CC_TX_ProfileGet(const CC_TX_instance_t *Instance, CC_TX_profile_t *Profile);
+
+/**
+ * @brief Clears the cycle counts of a CAN TX instance.
+ *
+ * @param Instance Pointer to the TX instance.
+ */
+void CC_TX_ProfileReset(CC_TX_instance_t *Instance);
+#endif
+
+#if CC_LATENCY
+/**
+ * @brief Attaches per-entry latency histograms to an RX instance.
+ *
+ * Must be called after CC_RX_init. Messages matching no entry are only counted
+ * in the instance histograms.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Slots Pointer to `TableSize` histograms, indexed by RX table position, or NULL.
+ */
+void CC_RX_LatencySlots_attach(CC_RX_instance_t *Instance, CC_RX_latency_t *Slots);
+
+/**
+ * @brief Takes a snapshot of the latency histograms of a CAN RX instance.
+ *
+ * Must be called from the polling context of the instance.
+ *
+ * @param Instance Pointer to the RX instance.
+ * @param Latency Pointer to the structure receiving the snapshot.
+ */
+void CC_RX_LatencyGet(const CC_RX_instance_t *Instance, CC_RX_latency_t *Latency);
+
+/**
+ * @brief Clears the latency histograms of a CAN RX instance, including per-entry ones.
+ *
+ * @param Instance Pointer to the RX instance.
+ */
+void CC_RX_LatencyReset(CC_RX_instance_t *Instance);
+
+/**
+ * @brief Takes a snapshot of the latency histogram of a CAN TX instance.
+ *
+ * Must be called from the polling context of the instance.
+ *
+ * @param Instance Pointer to the TX instance.
+ * @param Latency Pointer to the structure receiving the snapshot.
+ */
+void CC_TX_LatencyGet(const CC_TX_instance_t *Instance, CC_hist_t *Latency);
+
+/**
+ * @brief Clears the latency histogram of a CAN TX instance.
+ *
+ * @param Instance Pointer to the TX instance.
+ */
+void CC_TX_LatencyReset(CC_TX_instance_t *Instance);
+
+/**
+ * @brief Returns an upper bound of a percentile of a latency histogram.
+ *
+ * @param Hist Pointer to the histogram.
+ * @param Percent Percentile (0-100).
+ * @return uint32_t Upper bound in cycles of the bucket holding the percentile, the
+ *         longest sample for the last bucket, or 0 if the histogram is empty.
+ */
+uint32_t CC_Hist_Percentile(const CC_hist_t *Hist, uint8_t Percent);
+#endif
+
 #endif /* CAN_CORE_H_ */
@@ -0,0 +1,271 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#include "can_filter.h"
+#include "assert.h"
+#include <stddef.h>
+
+/**
+ * @brief Returns the mask covering all identifier bits of a frame type.
+ *
+ * @param[in] IDE_flag Identifier extension flag.
+ * @return uint32_t 11-bit mask for standard IDs, 29-bit mask for extended IDs.
+ */
+static inline uint32_t CC_Filter_FullMask(uint8_t IDE_flag)
+{
+    return IDE_flag ? 0x1FFFFFFFu : 0x7FFu;
+}
+
+/**
+ * @brief Computes the number of identifiers a filter accepts.
+ *
+ * @param[in] Filter Pointer to the filter.
+ * @return uint32_t Number of accepted identifiers.
+ */
+static uint32_t CC_Filter_Accepted(const CC_filter_t *Filter)
+{
+    uint32_t DontCare = CC_Filter_FullMask(Filter->IDE_flag) & ~Filter->Mask;
+    uint8_t Bits = 0;
+
+    for (; 0u != DontCare; DontCare &= DontCare - 1u)
+    {
+        Bits++;
+    }
+    return (uint32_t)1u << Bits;
+}
+
+/**
+ * @brief Computes the smallest filter accepting everything two filters accept.
+ *
+ * @param[in] A Pointer to the first filter.
+ * @param[in] B Pointer to the second filter.
+ * @param[out] Out Pointer to the merged filter.
+ */
+static inline void CC_Filter_Merge(const CC_filter_t *A, const CC_filter_t *B, CC_filter_t *Out)
+{
+    Out->Mask = A->Mask & B->Mask & ~(A->ID ^ B->ID);
+    Out->ID = A->ID & Out->Mask;
+    Out->IDE_flag = A->IDE_flag;
+}
+
+/**
+ * @brief Checks whether a filter accepts everything another filter accepts.
+ *
+ * @param[in] Outer Pointer to the covering filter candidate.
+ * @param[in] Inner Pointer to the covered filter candidate.
+ * @return uint8_t 1 if Outer covers Inner, otherwise 0.
+ */
+static inline uint8_t CC_Filter_Covers(const CC_filter_t *Outer, const CC_filter_t *Inner)
+{
+    return (Outer->IDE_flag == Inner->IDE_flag) && (0u == (Outer->Mask & ~Inner->Mask)) &&
+           ((Inner->ID & Outer->Mask) == Outer->ID);
+}
+
+/**
+ * @brief Orders filters by (IDE, ID) with insertion sort.
+ *
+ * @param[in,out] Filters Pointer to the filter array.
+ * @param[in] Count Number of filters.
+ */
+static void CC_Filter_Sort(CC_filter_t *Filters, uint16_t Count)
+{
+    for (uint16_t i = 1; i < Count; i++)
+    {
+        CC_filter_t Temp = Filters[i];
+        uint16_t j = i;
+
+        while ((j > 0) && ((Filters[j - 1].IDE_flag > Temp.IDE_flag) ||
+                           ((Filters[j - 1].IDE_flag == Temp.IDE_flag) && (Filters[j - 1].ID > Temp.ID))))
+        {
+            Filters[j] = Filters[j - 1];
+            j--;
+        }
+        Filters[j] = Temp;
+    }
+}
+
+/**
+ * @brief Removes the filter at a given position, keeping the order of the others.
+ *
+ * @param[in,out] Filters Pointer to the filter array.
+ * @param[in,out] Count Pointer to the number of filters.
+ * @param[in] Pos Position of the filter to remove.
+ */
+static void CC_Filter_Remove(CC_filter_t *Filters, uint16_t *Count, uint16_t Pos)
+{
+    for (uint16_t i = Pos; i + 1u < *Count; i++)
+    {
+        Filters[i] = Filters[i + 1u];
+    }
+    (*Count)--;
+}
+
+/**
+ * @brief Finds the cheapest merge of neighbouring filters within a range.
+ *
+ * @param[in] Filters Pointer to the filter array.
+ * @param[in] First Position of the first filter of the range.
+ * @param[in] Count Number of filters in the range.
+ * @param[out] Pos Position of the first filter of the cheapest pair.
+ * @return uint32_t Number of identifiers the merge adds, or UINT32_MAX if the range has fewer than two filters.
+ */
+static uint32_t CC_Filter_BestMerge(const CC_filter_t *Filters, uint16_t First, uint16_t Count, uint16_t *Pos)
+{
+    uint32_t Best = UINT32_MAX;
+
+    for (uint16_t i = First; i + 1u < First + Count; i++)
+    {
+        CC_filter_t Merged;
+        CC_Filter_Merge(&Filters[i], &Filters[i + 1u], &Merged);
+
+        uint32_t Accepted = CC_Filter_Accepted(&Merged);
+        uint32_t Sum = CC_Filter_Accepted(&Filters[i]) + CC_Filter_Accepted(&Filters[i + 1u]);
+        uint32_t Cost = (Accepted > Sum) ? (Accepted - Sum) : 0u;
+
+        if (Cost < Best)
+        {
+            Best = Cost;
+            *Pos = i;
+        }
+    }
+    return Best;
+}
+
+/**
+ * @brief Merges the filter pair at a given position and drops filters the result covers.
+ *
+ * @param[in,out] Filters Pointer to the filter array.
+ * @param[in,out] Total Pointer to the total number of filters.
+ * @param[in] First Position of the first filter of the range holding the pair.
+ * @param[in,out] Count Pointer to the number of filters in that range.
+ * @param[in] Pos Position of the first filter of the pair.
+ */
+static void CC_Filter_Apply(CC_filter_t *Filters, uint16_t *Total, uint16_t First, uint16_t *Count, uint16_t Pos)
+{
+    CC_filter_t Merged;
+
+    CC_Filter_Merge(&Filters[Pos], &Filters[Pos + 1u], &Merged);
+    Filters[Pos] = Merged;
+    CC_Filter_Remove(Filters, Total, Pos + 1u);
+    (*Count)--;
+
+    for (uint16_t i = First; i < First + *Count;)
+    {
+        if ((i != Pos) && CC_Filter_Covers(&Merged, &Filters[i]))
+        {
+            CC_Filter_Remove(Filters, Total, i);
+            (*Count)--;
+            if (i < Pos)
+            {
+                Pos--;
+            }
+        }
+        else
+        {
+            i++;
+        }
+    }
+    CC_Filter_Sort(&Filters[First], *Count);
+}
+
+/**
+ * @brief Computes acceptance filters for the IDs registered in an RX table.
+ *
+ * @param[in] RxTable Pointer to the RX message table.
+ * @param[in] TableSize Number of entries in RxTable.
+ * @param[in] Layout Pointer to the layout of the controller's filter banks.
+ * @param[out] Filters Pointer to the output array, holding at least TableSize entries.
+ * @param[out] OverAccept Optional pointer receiving an upper bound of over-accepted IDs.
+ * @return uint16_t Number of filters written, or CC_FILTER_ERROR.
+ */
+uint16_t CC_Filter_Generate(const CC_RX_table_t *RxTable, uint16_t TableSize, const CC_filter_layout_t *Layout,
+                            CC_filter_t *Filters, uint32_t *OverAccept)
+{
+    assert((NULL != Layout) && (NULL != Filters) && ((NULL != RxTable) || (0 == TableSize)));
+
+    uint16_t Total = 0;
+
+    for (uint16_t i = 0; i < TableSize; i++)
+    {
+        Filters[Total].IDE_flag = RxTable[i].IDE_flag;
+        Filters[Total].Mask = CC_Filter_FullMask(RxTable[i].IDE_flag);
+        Filters[Total].ID = RxTable[i].ID & Filters[Total].Mask;
+        Total++;
+    }
+    CC_Filter_Sort(Filters, Total);
+
+    for (uint16_t i = 1; i < Total;)
+    {
+        if ((Filters[i].IDE_flag == Filters[i - 1u].IDE_flag) && (Filters[i].ID == Filters[i - 1u].ID))
+        {
+            CC_Filter_Remove(Filters, &Total, i);
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    uint16_t StdCount = 0;
+    while ((StdCount < Total) && (0 == Filters[StdCount].IDE_flag))
+    {
+        StdCount++;
+    }
+    uint16_t ExtCount = Total - StdCount;
+    uint32_t Registered = Total;
+
+    uint16_t StdMin = ((StdCount > 0) && (0 == Layout->StdBanks)) ? 1u : 0u;
+    uint16_t ExtMin = ((ExtCount > 0) && (0 == Layout->ExtBanks)) ? 1u : 0u;
+    if (StdMin + ExtMin > Layout->SharedBanks)
+    {
+        return CC_FILTER_ERROR;
+    }
+
+    for (;;)
+    {
+        uint16_t StdExcess = (StdCount > Layout->StdBanks) ? (uint16_t)(StdCount - Layout->StdBanks) : 0u;
+        uint16_t ExtExcess = (ExtCount > Layout->ExtBanks) ? (uint16_t)(ExtCount - Layout->ExtBanks) : 0u;
+
+        if ((uint32_t)StdExcess + ExtExcess <= Layout->SharedBanks)
+        {
+            break;
+        }
+
+        uint16_t StdPos = 0;
+        uint16_t ExtPos = 0;
+        uint32_t StdCost = (StdExcess > 0) ? CC_Filter_BestMerge(Filters, 0, StdCount, &StdPos) : UINT32_MAX;
+        uint32_t ExtCost = (ExtExcess > 0) ? CC_Filter_BestMerge(Filters, StdCount, ExtCount, &ExtPos) : UINT32_MAX;
+
+        if ((UINT32_MAX == StdCost) && (UINT32_MAX == ExtCost))
+        {
+            return CC_FILTER_ERROR;
+        }
+        if (StdCost <= ExtCost)
+        {
+            CC_Filter_Apply(Filters, &Total, 0, &StdCount, StdPos);
+        }
+        else
+        {
+            CC_Filter_Apply(Filters, &Total, StdCount, &ExtCount, ExtPos);
+        }
+    }
+
+    if (NULL != OverAccept)
+    {
+        uint64_t Accepted = 0;
+        for (uint16_t i = 0; i < Total; i++)
+        {
+            Accepted += CC_Filter_Accepted(&Filters[i]);
+        }
+        Accepted -= Registered;
+        *OverAccept = (Accepted > UINT32_MAX) ? UINT32_MAX : (uint32_t)Accepted;
+    }
+    return Total;
+}
@@ -0,0 +1,88 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef CAN_FILTER_H_
+#define CAN_FILTER_H_
+
+#include "can_core.h"
+
+/**
+ * @def CC_FILTER_ERROR
+ * @brief Returned by CC_Filter_Generate when the registered IDs cannot be filtered
+ *        with the given layout (e.g. extended IDs but no bank able to hold them).
+ */
+#define CC_FILTER_ERROR 0xFFFFu
+
+/**
+ * @brief Hardware acceptance filter in ID/mask form.
+ *
+ * A frame is accepted if its IDE flag equals `IDE_flag` and
+ * `(FrameID & Mask) == ID`.
+ *
+ * Fields:
+ * - ID: Filter identifier, already masked.
+ * - Mask: Filter mask (1 = bit must match). 11 bits for standard, 29 bits for extended filters.
+ * - IDE_flag: Identifier Extension flag (0 = standard, 1 = extended).
+ */
+typedef struct
+{
+    uint32_t ID;
+    uint32_t Mask;
+    uint8_t IDE_flag;
+} CC_filter_t;
+
+/**
+ * @brief Description of the filter banks available in a CAN controller.
+ *
+ * Fields:
+ * - StdBanks: Number of ID/mask filters usable only for standard IDs.
+ * - ExtBanks: Number of ID/mask filters usable only for extended IDs.
+ * - SharedBanks: Number of ID/mask filters usable for either ID type.
+ */
+typedef struct
+{
+    uint16_t StdBanks;
+    uint16_t ExtBanks;
+    uint16_t SharedBanks;
+} CC_filter_layout_t;
+
+/**
+ * @brief Typical layouts: bxCAN in 32-bit mask mode (14 or 28 banks) and
+ *        FDCAN with its default standard/extended filter list sizes.
+ */
+#define CC_FILTER_LAYOUT_BXCAN_14 {0, 0, 14}
+#define CC_FILTER_LAYOUT_BXCAN_28 {0, 0, 28}
+#define CC_FILTER_LAYOUT_FDCAN {28, 8, 0}
+
+/**
+ * @brief Computes acceptance filters for the IDs registered in an RX table.
+ *
+ * Starts with one exact filter per registered (IDE, ID) pair and repeatedly merges
+ * the pair of neighbouring filters whose merge accepts the fewest additional IDs,
+ * until the filters fit the layout. Filters fully covered by a merged filter are
+ * dropped. Standard filters are returned first, followed by extended filters;
+ * standard ones go to `StdBanks` before `SharedBanks`, extended ones to `ExtBanks`
+ * before `SharedBanks`.
+ *
+ * Intended to run once at startup; it costs O(n^2) in the number of registered IDs.
+ *
+ * @param RxTable Pointer to the RX message table.
+ * @param TableSize Number of entries in RxTable.
+ * @param Layout Pointer to the layout of the controller's filter banks.
+ * @param Filters Pointer to the output array. Used as work space, so it must hold
+ *        TableSize entries.
+ * @param OverAccept Optional pointer receiving an upper bound of the number of
+ *        unregistered IDs that pass the filters. May be NULL.
+ * @return uint16_t Number of filters written, or CC_FILTER_ERROR.
+ */
+uint16_t CC_Filter_Generate(const CC_RX_table_t *RxTable, uint16_t TableSize, const CC_filter_layout_t *Layout,
+                            CC_filter_t *Filters, uint32_t *OverAccept);
+
+#endif /* CAN_FILTER_H_ */
@@ -0,0 +1,645 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#include "can_isotp.h"
+#include "assert.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Protocol control information types */
+#define CC_ISOTP_PCI_SF 0x0u
+#define CC_ISOTP_PCI_FF 0x1u
+#define CC_ISOTP_PCI_CF 0x2u
+#define CC_ISOTP_PCI_FC 0x3u
+
+/* Flow status values */
+#define CC_ISOTP_FS_CTS 0x0u
+#define CC_ISOTP_FS_WAIT 0x1u
+#define CC_ISOTP_FS_OVFLW 0x2u
+
+/* Session states */
+#define CC_ISOTP_RX_IDLE 0u
+#define CC_ISOTP_RX_BUSY 1u
+
+#define CC_ISOTP_TX_IDLE 0u
+#define CC_ISOTP_TX_WAIT_FC 1u
+#define CC_ISOTP_TX_SENDING 2u
+
+/**
+ * @brief Converts a raw STmin value into system ticks, rounded up.
+ *
+ * Reserved values are treated as the longest STmin (127 ms), as ISO 15765-2 requires.
+ *
+ * @param[in] STmin Raw STmin from a flow control frame.
+ * @return CC_TIME_VAL_t Separation time in system ticks.
+ */
+static CC_TIME_VAL_t CC_IsoTp_StminTicks(uint8_t STmin)
+{
+    if (STmin <= 0x7Fu)
+    {
+        return (CC_TIME_VAL_t)(STmin * CC_ISOTP_TICKS_PER_MS);
+    }
+    if ((STmin >= 0xF1u) && (STmin <= 0xF9u))
+    {
+        return (CC_TIME_VAL_t)(((STmin - 0xF0u) * CC_ISOTP_TICKS_PER_MS + 9u) / 10u);
+    }
+    return (CC_TIME_VAL_t)(0x7Fu * CC_ISOTP_TICKS_PER_MS);
+}
+
+/**
+ * @brief Pads a frame and pushes it to the TX instance of the session.
+ *
+ * Frames are padded to at least 8 bytes, and FD frames to the next valid FD length.
+ *
+ * @param[in] Session Pointer to the session.
+ * @param[in,out] Frame Pointer to the frame payload, CC_MAX_DATA_LEN bytes of storage.
+ * @param[in] Len Number of used payload bytes.
+ */
+static void CC_IsoTp_Push(const CC_isotp_t *Session, uint8_t *Frame, uint8_t Len)
+{
+    uint8_t Dlc = CC_LenToDlc((Len < 8u) ? (uint8_t)8u : Len);
+    uint8_t Padded = CC_DlcToLen(Dlc, 1);
+
+    if (Padded > Len)
+    {
+        memset(&Frame[Len], Session->PadByte, (size_t)(Padded - Len));
+    }
+
+#if CC_FD_SUPPORT
+    if (Session->FDF_flag)
+    {
+        CC_TX_PushMsgFD(Session->Tx, Session->TxID, Frame, Dlc, Session->IDE_flag, Session->BRS_flag);
+        return;
+    }
+#endif
+    CC_TX_PushMsg(Session->Tx, Session->TxID, Frame, Dlc, Session->IDE_flag);
+}
+
+/**
+ * @brief Sends a flow control frame.
+ *
+ * @param[in] Session Pointer to the session.
+ * @param[in] Status Flow status.
+ */
+static void CC_IsoTp_SendFc(const CC_isotp_t *Session, uint8_t Status)
+{
+    uint8_t Frame[CC_MAX_DATA_LEN];
+
+    Frame[0] = (uint8_t)((CC_ISOTP_PCI_FC << 4) | Status);
+    Frame[1] = Session->BlockSize;
+    Frame[2] = Session->STmin;
+    CC_IsoTp_Push(Session, Frame, 3);
+}
+
+/**
+ * @brief Sends a clear-to-send flow control frame, or defers it if the transmit buffer is full.
+ *
+ * @param[in,out] Session Pointer to the session.
+ */
+static void CC_IsoTp_Cts(CC_isotp_t *Session)
+{
+    Session->RxBlock = Session->BlockSize;
+
+    if (0 == CC_TX_FreeCount(Session->Tx))
+    {
+        Session->RxFcPending = 1;
+        return;
+    }
+    Session->RxFcPending = 0;
+    CC_IsoTp_SendFc(Session, CC_ISOTP_FS_CTS);
+}
+
+/**
+ * @brief Ends the current reception and reports its result.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] Result Result of the reception.
+ */
+static void CC_IsoTp_RxEnd(CC_isotp_t *Session, CC_isotp_result_t Result)
+{
+    Session->RxState = CC_ISOTP_RX_IDLE;
+    Session->RxFcPending = 0;
+    Session->RxDone(Session, Result, Session->RxBuf, Session->RxPos);
+}
+
+/**
+ * @brief Ends the current transmission and reports its result.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] Result Result of the transmission.
+ */
+static void CC_IsoTp_TxEnd(CC_isotp_t *Session, CC_isotp_result_t Result)
+{
+    Session->TxState = CC_ISOTP_TX_IDLE;
+    Session->TxData = NULL;
+    if (NULL != Session->TxDone)
+    {
+        Session->TxDone(Session, Result);
+    }
+}
+
+/**
+ * @brief Queues as many consecutive frames as flow control, STmin and the transmit buffer allow.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] Now Current system tick.
+ */
+static void CC_IsoTp_TxPump(CC_isotp_t *Session, CC_TIME_VAL_t Now)
+{
+    uint8_t Frame[CC_MAX_DATA_LEN];
+
+    while (CC_ISOTP_TX_SENDING == Session->TxState)
+    {
+        /* A tick count only bounds the real gap to one tick less, hence the strict compare. */
+        if (Session->TxHold && ((CC_TIME_VAL_t)(Now - Session->TxTick) <= Session->TxStmin))
+        {
+            return;
+        }
+        if (0 == CC_TX_FreeCount(Session->Tx))
+        {
+            return;
+        }
+
+        uint32_t Left = Session->TxLen - Session->TxPos;
+        uint8_t Len = (Left < (uint32_t)(Session->TxDL - 1u)) ? (uint8_t)Left : (uint8_t)(Session->TxDL - 1u);
+
+        Frame[0] = (uint8_t)((CC_ISOTP_PCI_CF << 4) | Session->TxSn);
+        memcpy(&Frame[1], &Session->TxData[Session->TxPos], Len);
+        CC_IsoTp_Push(Session, Frame, (uint8_t)(Len + 1u));
+
+        Session->TxPos += Len;
+        Session->TxSn = (uint8_t)((Session->TxSn + 1u) & 0x0Fu);
+        Session->TxTick = Now;
+        Session->TxHold = (0 != Session->TxStmin);
+
+        if (Session->TxPos == Session->TxLen)
+        {
+            CC_IsoTp_TxEnd(Session, CC_ISOTP_OK);
+            return;
+        }
+        if ((0 != Session->TxBs) && (0 == --Session->TxBlock))
+        {
+            Session->TxState = CC_ISOTP_TX_WAIT_FC;
+            Session->TxWft = 0;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Handles a received single frame.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] Data Pointer to the frame payload.
+ * @param[in] FrameLen Length of the frame payload.
+ */
+static void CC_IsoTp_RxSingle(CC_isotp_t *Session, const uint8_t *Data, uint8_t FrameLen)
+{
+    uint32_t Len = Data[0] & 0x0Fu;
+    uint8_t Off = 1;
+
+    if (FrameLen > 8u)
+    {
+        if (0u != Len)
+        {
+            return;
+        }
+        Len = Data[1];
+        Off = 2;
+    }
+    if ((0u == Len) || (Len > (uint32_t)(FrameLen - Off)))
+    {
+        return;
+    }
+
+    if (CC_ISOTP_RX_BUSY == Session->RxState)
+    {
+        CC_IsoTp_RxEnd(Session, CC_ISOTP_UNEXP_PDU);
+    }
+
+    uint8_t *Buf = Session->RxStart(Session, Len);
+
+    if (NULL == Buf)
+    {
+        return;
+    }
+    memcpy(Buf, &Data[Off], Len);
+    Session->RxBuf = Buf;
+    Session->RxLen = Len;
+    Session->RxPos = Len;
+    Session->RxDone(Session, CC_ISOTP_OK, Buf, Len);
+}
+
+/**
+ * @brief Handles a received first frame.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] Data Pointer to the frame payload.
+ * @param[in] FrameLen Length of the frame payload.
+ * @param[in] Now Current system tick.
+ */
+static void CC_IsoTp_RxFirst(CC_isotp_t *Session, const uint8_t *Data, uint8_t FrameLen, CC_TIME_VAL_t Now)
+{
+    uint32_t Len = ((uint32_t)(Data[0] & 0x0Fu) << 8) | Data[1];
+    uint8_t Off = 2;
+
+    if (FrameLen < 8u)
+    {
+        return;
+    }
+    if (0u == Len)
+    {
+        Len = ((uint32_t)Data[2] << 24) | ((uint32_t)Data[3] << 16) | ((uint32_t)Data[4] << 8) | Data[5];
+        Off = 6;
+    }
+    if (Len <= (uint32_t)(FrameLen - Off))
+    {
+        return;
+    }
+
+    if (CC_ISOTP_RX_BUSY == Session->RxState)
+    {
+        CC_IsoTp_RxEnd(Session, CC_ISOTP_UNEXP_PDU);
+    }
+
+    uint8_t *Buf = Session->RxStart(Session, Len);
+
+    if (NULL == Buf)
+    {
+        CC_IsoTp_SendFc(Session, CC_ISOTP_FS_OVFLW);
+        return;
+    }
+
+    Session->RxBuf = Buf;
+    Session->RxLen = Len;
+    Session->RxPos = (uint32_t)(FrameLen - Off);
+    memcpy(Buf, &Data[Off], Session->RxPos);
+    Session->RxSn = 1;
+    Session->RxTick = Now;
+    Session->RxState = CC_ISOTP_RX_BUSY;
+    CC_IsoTp_Cts(Session);
+}
+
+/**
+ * @brief Handles a received consecutive frame.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] Data Pointer to the frame payload.
+ * @param[in] FrameLen Length of the frame payload.
+ * @param[in] Now Current system tick.
+ */
+static void CC_IsoTp_RxConsecutive(CC_isotp_t *Session, const uint8_t *Data, uint8_t FrameLen, CC_TIME_VAL_t Now)
+{
+    if ((CC_ISOTP_RX_BUSY != Session->RxState) || (FrameLen < 2u))
+    {
+        return;
+    }
+    if ((Data[0] & 0x0Fu) != Session->RxSn)
+    {
+        CC_IsoTp_RxEnd(Session, CC_ISOTP_WRONG_SN);
+        return;
+    }
+
+    uint32_t Left = Session->RxLen - Session->RxPos;
+    uint32_t Len = (Left < (uint32_t)(FrameLen - 1u)) ? Left : (uint32_t)(FrameLen - 1u);
+
+    memcpy(&Session->RxBuf[Session->RxPos], &Data[1], Len);
+    Session->RxPos += Len;
+    Session->RxSn = (uint8_t)((Session->RxSn + 1u) & 0x0Fu);
+    Session->RxTick = Now;
+
+    if (Session->RxPos == Session->RxLen)
+    {
+        CC_IsoTp_RxEnd(Session, CC_ISOTP_OK);
+    }
+    else if ((0 != Session->BlockSize) && (0 == --Session->RxBlock))
+    {
+        CC_IsoTp_Cts(Session);
+    }
+}
+
+/**
+ * @brief Handles a received flow control frame.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] Data Pointer to the frame payload.
+ * @param[in] FrameLen Length of the frame payload.
+ * @param[in] Now Current system tick.
+ */
+static void CC_IsoTp_RxFlowControl(CC_isotp_t *Session, const uint8_t *Data, uint8_t FrameLen, CC_TIME_VAL_t Now)
+{
+    if ((CC_ISOTP_TX_WAIT_FC != Session->TxState) || (FrameLen < 3u))
+    {
+        return;
+    }
+
+    switch (Data[0] & 0x0Fu)
+    {
+    case CC_ISOTP_FS_CTS:
+        Session->TxBs = Data[1];
+        Session->TxBlock = Data[1];
+        Session->TxStmin = CC_IsoTp_StminTicks(Data[2]);
+        Session->TxHold = 0;
+        Session->TxState = CC_ISOTP_TX_SENDING;
+        CC_IsoTp_TxPump(Session, Now);
+        break;
+    case CC_ISOTP_FS_WAIT:
+        if (++Session->TxWft > Session->WftMax)
+        {
+            CC_IsoTp_TxEnd(Session, CC_ISOTP_WFT_OVRN);
+            break;
+        }
+        Session->TxTick = Now;
+        break;
+    case CC_ISOTP_FS_OVFLW:
+        CC_IsoTp_TxEnd(Session, CC_ISOTP_BUFFER_OVFLW);
+        break;
+    default:
+        CC_IsoTp_TxEnd(Session, CC_ISOTP_INVALID_FS);
+        break;
+    }
+}
+
+/**
+ * @brief RX protocol handler of a session.
+ *
+ * @param[in] Hook Pointer to the handler embedded in the session.
+ * @param[in] Instance Pointer to the RX instance.
+ * @param[in] Msg Pointer to the received message.
+ * @return uint8_t Non-zero if the message belongs to the session.
+ */
+static uint8_t CC_IsoTp_Handler(CC_RX_hook_t *Hook, const CC_RX_instance_t *Instance, CC_RX_message_t *Msg)
+{
+    CC_isotp_t *Session = (CC_isotp_t *)(void *)Hook;
+
+    (void)Instance;
+
+    if ((Msg->ID != Session->RxID) || (Msg->IDE_flag != Session->IDE_flag))
+    {
+        return 0;
+    }
+
+#if CC_FD_SUPPORT
+    uint8_t FrameLen = CC_DlcToLen(Msg->DLC, Msg->FDF_flag);
+#else
+    uint8_t FrameLen = CC_DlcToLen(Msg->DLC, 0);
+#endif
+    const uint8_t *Data = Msg->Data;
+    CC_TIME_VAL_t Now = CC_TX_TickGet(Session->Tx);
+
+    if (0 == FrameLen)
+    {
+        return 1;
+    }
+
+    switch (Data[0] >> 4)
+    {
+    case CC_ISOTP_PCI_SF:
+        CC_IsoTp_RxSingle(Session, Data, FrameLen);
+        break;
+    case CC_ISOTP_PCI_FF:
+        CC_IsoTp_RxFirst(Session, Data, FrameLen, Now);
+        break;
+    case CC_ISOTP_PCI_CF:
+        CC_IsoTp_RxConsecutive(Session, Data, FrameLen, Now);
+        break;
+    case CC_ISOTP_PCI_FC:
+        CC_IsoTp_RxFlowControl(Session, Data, FrameLen, Now);
+        break;
+    default:
+        break;
+    }
+    return 1;
+}
+
+/**
+ * @brief Initializes an ISO-TP session and attaches it to its RX instance.
+ *
+ * @param[out] Session Pointer to the session.
+ * @param[in,out] Rx Pointer to the RX instance.
+ * @param[in] Tx Pointer to the TX instance.
+ * @param[in] RxID Identifier of the received frames.
+ * @param[in] TxID Identifier of the transmitted frames.
+ * @param[in] IDE_flag Identifier Extension flag.
+ * @param[in] RxStart Pointer to the function returning the receive destination.
+ * @param[in] RxDone Pointer to the reception callback.
+ * @param[in] TxDone Pointer to the transmission callback, or NULL.
+ */
+void CC_IsoTp_init(CC_isotp_t *Session, CC_RX_instance_t *Rx, CC_TX_instance_t *Tx, uint32_t RxID, uint32_t TxID,
+                   uint8_t IDE_flag, uint8_t *(*RxStart)(CC_isotp_t *Session, uint32_t Len),
+                   void (*RxDone)(CC_isotp_t *Session, CC_isotp_result_t Result, uint8_t *Data, uint32_t Len),
+                   void (*TxDone)(CC_isotp_t *Session, CC_isotp_result_t Result))
+{
+    assert((NULL != Session) && (NULL != Rx) && (NULL != Tx) && (NULL != RxStart) && (NULL != RxDone));
+
+    *Session = (CC_isotp_t){0};
+    Session->Hook.Handler = CC_IsoTp_Handler;
+    Session->Tx = Tx;
+    Session->RxID = RxID;
+    Session->TxID = TxID;
+    Session->IDE_flag = IDE_flag;
+    Session->TxDL = 8;
+    Session->PadByte = 0xCC;
+    Session->TimeoutBs = (CC_TIME_VAL_t)CC_ISOTP_DEFAULT_TIMEOUT;
+    Session->TimeoutCr = (CC_TIME_VAL_t)CC_ISOTP_DEFAULT_TIMEOUT;
+    Session->RxStart = RxStart;
+    Session->RxDone = RxDone;
+    Session->TxDone = TxDone;
+
+    CC_RX_Hook_attach(Rx, &Session->Hook);
+}
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Switches the transmitted frames of a session to CAN FD.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] TxDL Payload length of transmitted frames.
+ * @param[in] BRS_flag Bit Rate Switch flag of transmitted frames.
+ */
+void CC_IsoTp_FD_init(CC_isotp_t *Session, uint8_t TxDL, uint8_t BRS_flag)
+{
+    assert((NULL != Session) && (TxDL >= 8u) && (CC_DlcToLen(CC_LenToDlc(TxDL), 1) == TxDL));
+
+    Session->TxDL = TxDL;
+    Session->FDF_flag = 1;
+    Session->BRS_flag = BRS_flag;
+}
+#endif
+
+/**
+ * @brief Starts sending a message.
+ *
+ * @param[in,out] Session Pointer to the session.
+ * @param[in] Data Pointer to the message.
+ * @param[in] Len Length of the message in bytes.
+ * @return uint8_t Non-zero if the transfer started.
+ */
+uint8_t CC_IsoTp_Send(CC_isotp_t *Session, const uint8_t *Data, uint32_t Len)
+{
+    assert((NULL != Session) && (NULL != Data) && (Len > 0u));
+
+    if ((CC_ISOTP_TX_IDLE != Session->TxState) || (0 == CC_TX_FreeCount(Session->Tx)))
+    {
+        return 0;
+    }
+
+    uint8_t Frame[CC_MAX_DATA_LEN];
+
+    if ((Len <= 7u) || (Len <= (uint32_t)(Session->TxDL - 2u)))
+    {
+        uint8_t Off = 1;
+
+        if (Len <= 7u)
+        {
+            Frame[0] = (uint8_t)Len;
+        }
+        else
+        {
+            Frame[0] = 0;
+            Frame[1] = (uint8_t)Len;
+            Off = 2;
+        }
+        memcpy(&Frame[Off], Data, Len);
+        CC_IsoTp_Push(Session, Frame, (uint8_t)(Len + Off));
+        CC_IsoTp_TxEnd(Session, CC_ISOTP_OK);
+        return 1;
+    }
+
+    uint8_t Off = 2;
+
+    if (Len <= 0xFFFu)
+    {
+        Frame[0] = (uint8_t)((CC_ISOTP_PCI_FF << 4) | (Len >> 8));
+        Frame[1] = (uint8_t)Len;
+    }
+    else
+    {
+        Frame[0] = (uint8_t)(CC_ISOTP_PCI_FF << 4);
+        Frame[1] = 0;
+        Frame[2] = (uint8_t)(Len >> 24);
+        Frame[3] = (uint8_t)(Len >> 16);
+        Frame[4] = (uint8_t)(Len >> 8);
+        Frame[5] = (uint8_t)Len;
+        Off = 6;
+    }
+
+    uint8_t Chunk = (uint8_t)(Session->TxDL - Off);
+
+    memcpy(&Frame[Off], Data, Chunk);
+    CC_IsoTp_Push(Session, Frame, Session->TxDL);
+
+    Session->TxData = Data;
+    Session->TxLen = Len;
+    Session->TxPos = Chunk;
+    Session->TxSn = 1;
+    Session->TxWft = 0;
+    Session->TxTick = CC_TX_TickGet(Session->Tx);
+    Session->TxState = CC_ISOTP_TX_WAIT_FC;
+    return 1;
+}
+
+/**
+ * @brief Sends pending frames and checks the timeouts of a session.
+ *
+ * @param[in,out] Session Pointer to the session.
+ */
+void CC_IsoTp_Poll(CC_isotp_t *Session)
+{
+    assert(NULL != Session);
+
+    CC_TIME_VAL_t Now = CC_TX_TickGet(Session->Tx);
+
+    if (CC_ISOTP_RX_BUSY == Session->RxState)
+    {
+        if ((CC_TIME_VAL_t)(Now - Session->RxTick) >= Session->TimeoutCr)
+        {
+            CC_IsoTp_RxEnd(Session, CC_ISOTP_TIMEOUT_CR);
+        }
+        else if (Session->RxFcPending)
+        {
+            CC_IsoTp_Cts(Session);
+        }
+    }
+
+    if (CC_ISOTP_TX_WAIT_FC == Session->TxState)
+    {
+        if ((CC_TIME_VAL_t)(Now - Session->TxTick) >= Session->TimeoutBs)
+        {
+            CC_IsoTp_TxEnd(Session, CC_ISOTP_TIMEOUT_BS);
+        }
+    }
+    else
+    {
+        CC_IsoTp_TxPump(Session, Now);
+    }
+}
+
+/**
+ * @brief Returns the time left until a deadline.
+ *
+ * @param[in] Start Tick at which the period started.
+ * @param[in] Period Length of the period.
+ * @param[in] Now Current system tick.
+ * @return CC_TIME_VAL_t Ticks left, 0 if the deadline has passed.
+ */
+static inline CC_TIME_VAL_t CC_IsoTp_Remaining(CC_TIME_VAL_t Start, CC_TIME_VAL_t Period, CC_TIME_VAL_t Now)
+{
+    CC_TIME_VAL_t Elapsed = (CC_TIME_VAL_t)(Now - Start);
+
+    return (Elapsed >= Period) ? (CC_TIME_VAL_t)0 : (CC_TIME_VAL_t)(Period - Elapsed);
+}
+
+/**
+ * @brief Returns the time until the session needs the next CC_IsoTp_Poll call.
+ *
+ * A session waiting for room in the transmit buffer reports one tick, unless the
+ * TX instance wakes the task earlier (see CC_TX_Notify_init).
+ *
+ * @param[in] Session Pointer to the session.
+ * @return CC_TIME_VAL_t System ticks until the next event.
+ */
+CC_TIME_VAL_t CC_IsoTp_NextEvent(CC_isotp_t *Session)
+{
+    assert(NULL != Session);
+
+    CC_TIME_VAL_t Now = CC_TX_TickGet(Session->Tx);
+    CC_TIME_VAL_t Next = (CC_TIME_VAL_t)CC_MAX_TIMEOUT;
+    CC_TIME_VAL_t Left;
+
+    if (CC_ISOTP_RX_BUSY == Session->RxState)
+    {
+        Next = Session->RxFcPending ? (CC_TIME_VAL_t)1
+                                    : CC_IsoTp_Remaining(Session->RxTick, Session->TimeoutCr, Now);
+    }
+
+    if (CC_ISOTP_TX_WAIT_FC == Session->TxState)
+    {
+        Left = CC_IsoTp_Remaining(Session->TxTick, Session->TimeoutBs, Now);
+        Next = (Left < Next) ? Left : Next;
+    }
+    else if (CC_ISOTP_TX_SENDING == Session->TxState)
+    {
+        if (Session->TxHold)
+        {
+            Left = CC_IsoTp_Remaining(Session->TxTick, (CC_TIME_VAL_t)(Session->TxStmin + 1u), Now);
+        }
+        else
+        {
+            Left = 0;
+        }
+        if ((0 == Left) && (0 == CC_TX_FreeCount(Session->Tx)))
+        {
+            Left = 1;
+        }
+        Next = (Left < Next) ? Left : Next;
+    }
+    return Next;
+}
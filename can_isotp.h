@@ -0,0 +1,199 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef CAN_ISOTP_H_
+#define CAN_ISOTP_H_
+
+#include "can_core.h"
+
+/**
+ * @def CC_ISOTP_TICKS_PER_MS
+ * @brief Number of system ticks per millisecond, used to convert STmin values.
+ */
+#define CC_ISOTP_TICKS_PER_MS 1
+
+/**
+ * @def CC_ISOTP_DEFAULT_TIMEOUT
+ * @brief Default N_Bs and N_Cr timeouts of a session in system ticks.
+ */
+#define CC_ISOTP_DEFAULT_TIMEOUT (1000 * CC_ISOTP_TICKS_PER_MS)
+
+/**
+ * @brief Result of an ISO-TP transfer, following the N_Result values of ISO 15765-2.
+ *
+ * Values:
+ * - CC_ISOTP_OK: Transfer completed.
+ * - CC_ISOTP_TIMEOUT_BS: No flow control frame received within `TimeoutBs`.
+ * - CC_ISOTP_TIMEOUT_CR: No consecutive frame received within `TimeoutCr`.
+ * - CC_ISOTP_WRONG_SN: Consecutive frame with an unexpected sequence number.
+ * - CC_ISOTP_UNEXP_PDU: Reception interrupted by a new single or first frame.
+ * - CC_ISOTP_WFT_OVRN: More than `WftMax` flow control WAIT frames in a row.
+ * - CC_ISOTP_BUFFER_OVFLW: The receiver reported an overflow, or RxStart refused the message.
+ * - CC_ISOTP_INVALID_FS: Flow control frame with an invalid flow status.
+ */
+typedef enum
+{
+    CC_ISOTP_OK = 0,
+    CC_ISOTP_TIMEOUT_BS,
+    CC_ISOTP_TIMEOUT_CR,
+    CC_ISOTP_WRONG_SN,
+    CC_ISOTP_UNEXP_PDU,
+    CC_ISOTP_WFT_OVRN,
+    CC_ISOTP_BUFFER_OVFLW,
+    CC_ISOTP_INVALID_FS
+} CC_isotp_result_t;
+
+/**
+ * @brief ISO-TP session bound to an RX/TX instance pair (normal addressing).
+ *
+ * Frames with `RxID` are taken by the session during CC_RX_Poll of the RX instance,
+ * before the RX table lookup, and the payload of every frame is copied straight from
+ * the receive buffer into the destination returned by `RxStart`. Segmented messages
+ * are sent by CC_IsoTp_Poll, paced by the block size and STmin of the receiver and
+ * by the free space of the transmit buffer.
+ *
+ * Configuration fields (set by CC_IsoTp_init, may be changed while the session is idle):
+ * - Hook: RX protocol handler of the session, must stay the first member.
+ * - Tx: TX instance the session sends on.
+ * - RxID / TxID: Identifiers of received and transmitted frames.
+ * - IDE_flag: Identifier Extension flag of both identifiers.
+ * - TxDL: Payload length of transmitted frames (8, or 12-64 with CC_FD_SUPPORT).
+ * - FDF_flag / BRS_flag: Frame format of transmitted frames, see CC_IsoTp_FD_init.
+ * - PadByte: Value of the padding bytes; frames are padded to at least 8 bytes.
+ * - BlockSize: Block size sent in flow control frames, 0 = no further flow control.
+ * - STmin: Raw STmin sent in flow control frames.
+ * - WftMax: Number of flow control WAIT frames accepted in a row.
+ * - TimeoutBs / TimeoutCr: N_Bs and N_Cr timeouts in system ticks.
+ * - RxStart: Returns the destination of a received message of `Len` bytes, or NULL
+ *   to refuse it (a first frame is then answered with an overflow flow control).
+ * - RxDone: Called when a reception completes or fails; `Data` and `Len` give the
+ *   destination and the number of bytes received.
+ * - TxDone: Called when a transfer started by CC_IsoTp_Send completes or fails, optional.
+ *
+ * The remaining fields hold the transfer state and are maintained by the library.
+ */
+typedef struct CC_isotp_t CC_isotp_t;
+struct CC_isotp_t
+{
+    CC_RX_hook_t Hook;
+    CC_TX_instance_t *Tx;
+    uint32_t RxID;
+    uint32_t TxID;
+    uint8_t IDE_flag;
+    uint8_t TxDL;
+    uint8_t FDF_flag;
+    uint8_t BRS_flag;
+    uint8_t PadByte;
+    uint8_t BlockSize;
+    uint8_t STmin;
+    uint8_t WftMax;
+    CC_TIME_VAL_t TimeoutBs;
+    CC_TIME_VAL_t TimeoutCr;
+    uint8_t *(*RxStart)(CC_isotp_t *Session, uint32_t Len);
+    void (*RxDone)(CC_isotp_t *Session, CC_isotp_result_t Result, uint8_t *Data, uint32_t Len);
+    void (*TxDone)(CC_isotp_t *Session, CC_isotp_result_t Result);
+
+    uint8_t RxState;
+    uint8_t RxSn;
+    uint8_t RxBlock;
+    uint8_t RxFcPending;
+    uint8_t *RxBuf;
+    uint32_t RxLen;
+    uint32_t RxPos;
+    CC_TIME_VAL_t RxTick;
+
+    uint8_t TxState;
+    uint8_t TxSn;
+    uint8_t TxBlock;
+    uint8_t TxBs;
+    uint8_t TxWft;
+    uint8_t TxHold;
+    const uint8_t *TxData;
+    uint32_t TxLen;
+    uint32_t TxPos;
+    CC_TIME_VAL_t TxStmin;
+    CC_TIME_VAL_t TxTick;
+};
+
+/**
+ * @brief Initializes an ISO-TP session and attaches it to its RX instance.
+ *
+ * Must be called after CC_RX_init and CC_TX_init. The session sends classic 8-byte
+ * frames padded with 0xCC, with block size 0, STmin 0 and CC_ISOTP_DEFAULT_TIMEOUT
+ * timeouts; see CC_isotp_t for the fields that can be changed afterwards.
+ * CC_IsoTp_Send and CC_IsoTp_Poll must run in the context of CC_RX_Poll of the RX
+ * instance, which is also the only context pushing to the TX instance on behalf of
+ * the session.
+ *
+ * @param Session Pointer to the session.
+ * @param Rx Pointer to the RX instance receiving `RxID`.
+ * @param Tx Pointer to the TX instance sending `TxID`.
+ * @param RxID Identifier of the received frames.
+ * @param TxID Identifier of the transmitted frames.
+ * @param IDE_flag Identifier Extension flag (0 = standard, 1 = extended).
+ * @param RxStart Pointer to the function returning the receive destination.
+ * @param RxDone Pointer to the reception callback.
+ * @param TxDone Pointer to the transmission callback, or NULL.
+ */
+void CC_IsoTp_init(CC_isotp_t *Session, CC_RX_instance_t *Rx, CC_TX_instance_t *Tx, uint32_t RxID, uint32_t TxID,
+                   uint8_t IDE_flag, uint8_t *(*RxStart)(CC_isotp_t *Session, uint32_t Len),
+                   void (*RxDone)(CC_isotp_t *Session, CC_isotp_result_t Result, uint8_t *Data, uint32_t Len),
+                   void (*TxDone)(CC_isotp_t *Session, CC_isotp_result_t Result));
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Switches the transmitted frames of a session to CAN FD.
+ *
+ * Frames up to `TxDL` bytes are sent, padded to the next valid FD length. The TX
+ * instance payload storage must hold `TxDL` bytes (see CC_TX_FD_init). Received
+ * frames are accepted in either format.
+ *
+ * @param Session Pointer to the session.
+ * @param TxDL Payload length of transmitted frames (8, 12, 16, 20, 24, 32, 48 or 64).
+ * @param BRS_flag Bit Rate Switch flag of transmitted frames.
+ */
+void CC_IsoTp_FD_init(CC_isotp_t *Session, uint8_t TxDL, uint8_t BRS_flag);
+#endif
+
+/**
+ * @brief Starts sending a message.
+ *
+ * A single frame is queued at once. A longer message is queued as a first frame,
+ * and its consecutive frames are sent by CC_IsoTp_Poll as flow control allows.
+ * The data is kept by reference until TxDone is called.
+ *
+ * @param Session Pointer to the session.
+ * @param Data Pointer to the message.
+ * @param Len Length of the message in bytes (1 to 2^32 - 1).
+ * @return uint8_t Non-zero if the transfer started, 0 if the session is busy sending
+ *         or the transmit buffer is full.
+ */
+uint8_t CC_IsoTp_Send(CC_isotp_t *Session, const uint8_t *Data, uint32_t Len);
+
+/**
+ * @brief Sends pending consecutive and flow control frames and checks the timeouts.
+ *
+ * Should be called after CC_RX_Poll of the RX instance, or whenever
+ * CC_IsoTp_NextEvent says the session is due.
+ *
+ * @param Session Pointer to the session.
+ */
+void CC_IsoTp_Poll(CC_isotp_t *Session);
+
+/**
+ * @brief Returns the time until the session needs the next CC_IsoTp_Poll call.
+ *
+ * @param Session Pointer to the session.
+ * @return CC_TIME_VAL_t System ticks until the next event, 0 if frames can be sent now,
+ *         or CC_MAX_TIMEOUT if the session is idle.
+ */
+CC_TIME_VAL_t CC_IsoTp_NextEvent(CC_isotp_t *Session);
+
+#endif /* CAN_ISOTP_H_ */
@@ -0,0 +1,149 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#include "can_shard.h"
+#include "assert.h"
+#include <stddef.h>
+
+/**
+ * @brief Initializes a shard set.
+ *
+ * @param[out] Set Pointer to the shard set.
+ * @param[out] Shards Pointer to `Count` RX instances.
+ * @param[in] Count Number of shards (at least 1).
+ * @param[in] Buf Pointer to `Count * BufSize` messages of receive buffer storage.
+ * @param[in] BufSize Number of messages in the receive buffer of each shard (at least 2).
+ * @param[in,out] RxTable Pointer to the RX message registration table, reordered by shard.
+ * @param[in] TableSize Number of entries in the RxTable.
+ * @param[in] Parser_unreg_msg Callback for parsing unregistered messages.
+ * @param[in] TimeoutCallback Callback for timeout handling.
+ */
+void CC_Shard_init(CC_shard_set_t *Set, CC_RX_instance_t *Shards, uint8_t Count, CC_RX_message_t *Buf,
+                   uint16_t BufSize, CC_RX_table_t *RxTable, uint16_t TableSize,
+                   void (*Parser_unreg_msg)(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg),
+                   void (*TimeoutCallback)(CC_RX_instance_t *Instance, uint16_t Slot))
+{
+    assert((NULL != Set) && (NULL != Shards) && (Count >= 1) && (NULL != Buf));
+    assert((NULL != RxTable) || (0 == TableSize));
+
+    uint16_t Start = 0;
+
+    Set->Shards = Shards;
+    Set->Count = Count;
+
+    for (uint8_t s = 0; s < Count; s++)
+    {
+        uint16_t End = Start;
+
+        /* Rotates the entries of shard `s` to the front of the unsorted part, keeping the
+         * relative order of all entries so duplicate keys still match in table order. */
+        for (uint16_t i = Start; i < TableSize; i++)
+        {
+            if (CC_Shard_Index(Count, RxTable[i].ID, RxTable[i].IDE_flag) == s)
+            {
+                if (i != End)
+                {
+                    CC_RX_table_t Entry = RxTable[i];
+
+                    for (uint16_t j = i; j > End; j--)
+                    {
+                        RxTable[j] = RxTable[j - 1u];
+                    }
+                    RxTable[End] = Entry;
+                }
+                End++;
+            }
+        }
+
+        CC_RX_init(&Shards[s], &Buf[(size_t)s * BufSize], BufSize, (End > Start) ? &RxTable[Start] : NULL,
+                   (uint16_t)(End - Start), Parser_unreg_msg, TimeoutCallback);
+        Start = End;
+    }
+}
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Registers the payload storage of all shards.
+ *
+ * @param[in,out] Set Pointer to the shard set.
+ * @param[in] Payload Pointer to at least `Count * BufSize * PayloadSize` bytes of storage.
+ * @param[in] PayloadSize Payload bytes per slot (8-64).
+ */
+void CC_Shard_FD_init(CC_shard_set_t *Set, uint8_t *Payload, uint8_t PayloadSize)
+{
+    assert((NULL != Set) && (NULL != Payload));
+
+    size_t Offset = 0;
+
+    for (uint8_t s = 0; s < Set->Count; s++)
+    {
+        CC_RX_FD_init(&Set->Shards[s], &Payload[Offset], PayloadSize);
+        Offset += (size_t)Set->Shards[s].Ring.Size * PayloadSize;
+    }
+}
+#endif
+
+/**
+ * @brief Returns the shard instance receiving a given identifier.
+ *
+ * @param[in] Set Pointer to the shard set.
+ * @param[in] ID CAN message identifier.
+ * @param[in] IDE_flag Identifier Extension flag.
+ * @return CC_RX_instance_t* Pointer to the shard instance.
+ */
+CC_RX_instance_t *CC_Shard_Select(CC_shard_set_t *Set, uint32_t ID, uint8_t IDE_flag)
+{
+    assert(NULL != Set);
+
+    return &Set->Shards[CC_Shard_Index(Set->Count, ID, IDE_flag)];
+}
+
+/**
+ * @brief Pushes a received classic CAN frame to its shard.
+ *
+ * @param[in,out] Set Pointer to the shard set.
+ * @param[in] ID CAN message identifier.
+ * @param[in] Data Pointer to the data bytes of the CAN message.
+ * @param[in] DLC Data Length Code (0-15).
+ * @param[in] IDE_flag Identifier Extension flag (0 for standard, 1 for extended).
+ */
+void CC_Shard_PushMsg(CC_shard_set_t *Set, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag)
+{
+    assert(NULL != Set);
+
+    CC_RX_PushMsg(&Set->Shards[CC_Shard_Index(Set->Count, ID, IDE_flag)], ID, Data, DLC, IDE_flag);
+}
+
+/**
+ * @brief Processes the received messages and timeouts of one shard.
+ *
+ * @param[in,out] Set Pointer to the shard set.
+ * @param[in] Shard Index of the shard.
+ */
+void CC_Shard_Poll(CC_shard_set_t *Set, uint8_t Shard)
+{
+    assert((NULL != Set) && (Shard < Set->Count));
+
+    CC_RX_Poll(&Set->Shards[Shard]);
+}
+
+/**
+ * @brief Returns the time until a shard needs the next CC_Shard_Poll call.
+ *
+ * @param[in,out] Set Pointer to the shard set.
+ * @param[in] Shard Index of the shard.
+ * @return CC_TIME_VAL_t See CC_RX_NextEvent.
+ */
+CC_TIME_VAL_t CC_Shard_NextEvent(CC_shard_set_t *Set, uint8_t Shard)
+{
+    assert((NULL != Set) && (Shard < Set->Count));
+
+    return CC_RX_NextEvent(&Set->Shards[Shard]);
+}
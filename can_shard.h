@@ -0,0 +1,137 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef CAN_SHARD_H_
+#define CAN_SHARD_H_
+
+#include "can_core.h"
+
+/**
+ * @brief RX table split by identifier hash across several RX instances.
+ *
+ * Every shard is a complete RX instance with its own receive ring, its own part of
+ * the RX table and its own timeout scheduler, polled by its own worker thread. The
+ * ingest side hashes the identifier of each frame to pick the shard, so all frames
+ * of one identifier pass through the same single-producer single-consumer ring and
+ * are parsed in reception order by the same worker.
+ *
+ * Threading rules:
+ * - One ingest context pushes to all shards (CC_Shard_PushMsg, or the RX push
+ *   functions on the instance returned by CC_Shard_Select).
+ * - Shard `i` is only polled by its worker (CC_Shard_Poll with `i`).
+ * - Parsers, Parser_unreg_msg and TimeoutCallback run in the worker threads, so the
+ *   shared ones must be reentrant; parsers of different entries run concurrently.
+ * - On SMP hosts, build with CC_SYNC_MODE set to CC_SYNC_C11.
+ *
+ * Fields:
+ * - Shards: Array of `Count` RX instances.
+ * - Count: Number of shards.
+ */
+typedef struct
+{
+    CC_RX_instance_t *Shards;
+    uint8_t Count;
+} CC_shard_set_t;
+
+/**
+ * @brief Returns the shard receiving a given identifier.
+ *
+ * @param Count Number of shards.
+ * @param ID CAN message identifier.
+ * @param IDE_flag Identifier Extension flag.
+ * @return uint8_t Index of the shard.
+ */
+static inline uint8_t CC_Shard_Index(uint8_t Count, uint32_t ID, uint8_t IDE_flag)
+{
+    uint32_t Hash = ((ID << 1) | (IDE_flag & 1u)) * 2654435761u;
+
+    return (uint8_t)(((uint64_t)Hash * Count) >> 32);
+}
+
+/**
+ * @brief Initializes a shard set.
+ *
+ * Reorders `RxTable` in place so that the entries of each shard are contiguous, and
+ * initializes every shard with CC_RX_init on its part of the table. The reordering is
+ * stable: entries of one shard keep their relative table order, so entries with the
+ * same key match in the same order as in the unsharded table. Entries keep their
+ * `SlotNo`. Features of single instances (lookup keys, hooks, notifications,
+ * statistics) can be set up afterwards on `Set->Shards[i]`.
+ *
+ * @param Set Pointer to the shard set.
+ * @param Shards Pointer to `Count` RX instances.
+ * @param Count Number of shards (at least 1).
+ * @param Buf Pointer to `Count * BufSize` messages of receive buffer storage.
+ * @param BufSize Number of messages in the receive buffer of each shard (at least 2).
+ * @param RxTable Pointer to the RX message registration table.
+ * @param TableSize Number of entries in the RxTable.
+ * @param Parser_unreg_msg Callback for parsing unregistered messages, shared by all shards.
+ * @param TimeoutCallback Callback for timeout handling, shared by all shards.
+ */
+void CC_Shard_init(CC_shard_set_t *Set, CC_RX_instance_t *Shards, uint8_t Count, CC_RX_message_t *Buf,
+                   uint16_t BufSize, CC_RX_table_t *RxTable, uint16_t TableSize,
+                   void (*Parser_unreg_msg)(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg),
+                   void (*TimeoutCallback)(CC_RX_instance_t *Instance, uint16_t Slot));
+
+#if CC_FD_SUPPORT
+/**
+ * @brief Registers the payload storage of all shards.
+ *
+ * @param Set Pointer to the shard set.
+ * @param Payload Pointer to at least `Count * BufSize * PayloadSize` bytes of storage.
+ * @param PayloadSize Payload bytes per slot (8-64).
+ */
+void CC_Shard_FD_init(CC_shard_set_t *Set, uint8_t *Payload, uint8_t PayloadSize);
+#endif
+
+/**
+ * @brief Returns the shard instance receiving a given identifier.
+ *
+ * For drivers using the other RX push functions (timestamps, CAN FD, reserve and
+ * commit) on the selected instance.
+ *
+ * @param Set Pointer to the shard set.
+ * @param ID CAN message identifier.
+ * @param IDE_flag Identifier Extension flag.
+ * @return CC_RX_instance_t* Pointer to the shard instance.
+ */
+CC_RX_instance_t *CC_Shard_Select(CC_shard_set_t *Set, uint32_t ID, uint8_t IDE_flag);
+
+/**
+ * @brief Pushes a received classic CAN frame to its shard.
+ *
+ * @param Set Pointer to the shard set.
+ * @param ID CAN message identifier.
+ * @param Data Pointer to the data bytes of the CAN message.
+ * @param DLC Data Length Code (0-15).
+ * @param IDE_flag Identifier Extension flag (0 for standard, 1 for extended).
+ */
+void CC_Shard_PushMsg(CC_shard_set_t *Set, uint32_t ID, uint8_t *Data, uint8_t DLC, uint8_t IDE_flag);
+
+/**
+ * @brief Processes the received messages and timeouts of one shard.
+ *
+ * Must only be called by the worker of the shard.
+ *
+ * @param Set Pointer to the shard set.
+ * @param Shard Index of the shard.
+ */
+void CC_Shard_Poll(CC_shard_set_t *Set, uint8_t Shard);
+
+/**
+ * @brief Returns the time until a shard needs the next CC_Shard_Poll call.
+ *
+ * @param Set Pointer to the shard set.
+ * @param Shard Index of the shard.
+ * @return CC_TIME_VAL_t See CC_RX_NextEvent.
+ */
+CC_TIME_VAL_t CC_Shard_NextEvent(CC_shard_set_t *Set, uint8_t Shard);
+
+#endif /* CAN_SHARD_H_ */
@@ -0,0 +1,419 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#include "can_signal.h"
+#include "assert.h"
+#include <stddef.h>
+
+/**
+ * @brief Location of a signal in the payload.
+ *
+ * Fields:
+ * - First: Index of the first payload byte covered by the signal.
+ * - Bytes: Number of covered bytes (1-9).
+ * - Shift: Position of the least significant signal bit in the last loaded byte.
+ */
+typedef struct
+{
+    uint16_t First;
+    uint8_t Bytes;
+    uint8_t Shift;
+} CC_sig_span_t;
+
+/**
+ * @brief Computes the payload bytes covered by a signal.
+ *
+ * For Intel signals the bytes are loaded little endian and `Shift` counts from the
+ * first byte; for Motorola signals they are loaded big endian and `Shift` counts
+ * from the last byte.
+ *
+ * @param[in] Sig Pointer to the signal descriptor.
+ * @param[out] Span Pointer to the computed location.
+ */
+static inline void CC_Signal_Span(const CC_signal_t *Sig, CC_sig_span_t *Span)
+{
+    Span->First = (uint16_t)(Sig->StartBit >> 3);
+
+    if (CC_SIG_INTEL == Sig->Order)
+    {
+        Span->Shift = (uint8_t)(Sig->StartBit & 7u);
+        Span->Bytes = (uint8_t)((Span->Shift + Sig->Length + 7u) >> 3);
+    }
+    else
+    {
+        uint16_t Lsb = (uint16_t)((Span->First << 3) + (7u - (Sig->StartBit & 7u)) + Sig->Length - 1u);
+
+        Span->Shift = (uint8_t)(7u - (Lsb & 7u));
+        Span->Bytes = (uint8_t)((Lsb >> 3) - Span->First + 1u);
+    }
+}
+
+/**
+ * @brief Returns the mask of the low `Length` bits.
+ *
+ * @param[in] Length Number of bits (1-64).
+ * @return uint64_t Bit mask.
+ */
+static inline uint64_t CC_Signal_Mask(uint8_t Length)
+{
+    return (Length >= 64u) ? UINT64_MAX : (((uint64_t)1u << Length) - 1u);
+}
+
+/**
+ * @brief Loads up to 8 bytes as a little-endian word.
+ *
+ * @param[in] Data Pointer to the first byte.
+ * @param[in] Count Number of bytes (1-8).
+ * @return uint64_t Loaded word.
+ */
+static inline uint64_t CC_Signal_LoadLE(const uint8_t *Data, uint8_t Count)
+{
+    uint64_t Word = 0;
+
+    for (uint8_t i = Count; i > 0u; i--)
+    {
+        Word = (Word << 8) | Data[i - 1u];
+    }
+    return Word;
+}
+
+/**
+ * @brief Loads up to 8 bytes as a big-endian word.
+ *
+ * @param[in] Data Pointer to the first byte.
+ * @param[in] Count Number of bytes (1-8).
+ * @return uint64_t Loaded word.
+ */
+static inline uint64_t CC_Signal_LoadBE(const uint8_t *Data, uint8_t Count)
+{
+    uint64_t Word = 0;
+
+    for (uint8_t i = 0; i < Count; i++)
+    {
+        Word = (Word << 8) | Data[i];
+    }
+    return Word;
+}
+
+/**
+ * @brief Stores a word as up to 8 little-endian bytes.
+ *
+ * @param[out] Data Pointer to the first byte.
+ * @param[in] Count Number of bytes (1-8).
+ * @param[in] Word Word to store.
+ */
+static inline void CC_Signal_StoreLE(uint8_t *Data, uint8_t Count, uint64_t Word)
+{
+    for (uint8_t i = 0; i < Count; i++)
+    {
+        Data[i] = (uint8_t)Word;
+        Word >>= 8;
+    }
+}
+
+/**
+ * @brief Stores a word as up to 8 big-endian bytes.
+ *
+ * @param[out] Data Pointer to the first byte.
+ * @param[in] Count Number of bytes (1-8).
+ * @param[in] Word Word to store.
+ */
+static inline void CC_Signal_StoreBE(uint8_t *Data, uint8_t Count, uint64_t Word)
+{
+    for (uint8_t i = Count; i > 0u; i--)
+    {
+        Data[i - 1u] = (uint8_t)Word;
+        Word >>= 8;
+    }
+}
+
+/**
+ * @brief Extracts the raw value of a signal.
+ *
+ * A signal of up to 64 bits can straddle 9 bytes; the ninth byte is merged into
+ * the word separately.
+ *
+ * @param[in] Sig Pointer to the signal descriptor.
+ * @param[in] Data Pointer to the payload.
+ * @return uint64_t Raw value, not sign extended.
+ */
+uint64_t CC_Signal_GetRaw(const CC_signal_t *Sig, const uint8_t *Data)
+{
+    assert((NULL != Sig) && (NULL != Data) && (Sig->Length >= 1u) && (Sig->Length <= 64u));
+
+    CC_sig_span_t Span;
+    uint64_t Raw;
+
+    CC_Signal_Span(Sig, &Span);
+
+    const uint8_t *Src = &Data[Span.First];
+
+    if (CC_SIG_INTEL == Sig->Order)
+    {
+        if (Span.Bytes > 8u)
+        {
+            Raw = (CC_Signal_LoadLE(Src, 8u) >> Span.Shift) | ((uint64_t)Src[8] << (64u - Span.Shift));
+        }
+        else
+        {
+            Raw = CC_Signal_LoadLE(Src, Span.Bytes) >> Span.Shift;
+        }
+    }
+    else
+    {
+        if (Span.Bytes > 8u)
+        {
+            Raw = (CC_Signal_LoadBE(Src, 8u) << (8u - Span.Shift)) | (uint64_t)(Src[8] >> Span.Shift);
+        }
+        else
+        {
+            Raw = CC_Signal_LoadBE(Src, Span.Bytes) >> Span.Shift;
+        }
+    }
+    return Raw & CC_Signal_Mask(Sig->Length);
+}
+
+/**
+ * @brief Inserts the raw value of a signal.
+ *
+ * @param[in] Sig Pointer to the signal descriptor.
+ * @param[in,out] Data Pointer to the payload.
+ * @param[in] Raw Raw value; bits above the signal length are ignored.
+ */
+void CC_Signal_SetRaw(const CC_signal_t *Sig, uint8_t *Data, uint64_t Raw)
+{
+    assert((NULL != Sig) && (NULL != Data) && (Sig->Length >= 1u) && (Sig->Length <= 64u));
+
+    CC_sig_span_t Span;
+    uint64_t Mask = CC_Signal_Mask(Sig->Length);
+
+    CC_Signal_Span(Sig, &Span);
+    Raw &= Mask;
+
+    uint8_t *Dst = &Data[Span.First];
+
+    if (CC_SIG_INTEL == Sig->Order)
+    {
+        uint8_t Count = (Span.Bytes > 8u) ? 8u : Span.Bytes;
+        uint64_t Word = CC_Signal_LoadLE(Dst, Count);
+
+        Word = (Word & ~(Mask << Span.Shift)) | (Raw << Span.Shift);
+        CC_Signal_StoreLE(Dst, Count, Word);
+
+        if (Span.Bytes > 8u)
+        {
+            uint8_t High = (uint8_t)(Mask >> (64u - Span.Shift));
+
+            Dst[8] = (uint8_t)((Dst[8] & ~High) | (uint8_t)(Raw >> (64u - Span.Shift)));
+        }
+    }
+    else
+    {
+        if (Span.Bytes > 8u)
+        {
+            uint8_t Low = (uint8_t)(0xFFu << Span.Shift);
+            uint64_t Word = CC_Signal_LoadBE(Dst, 8u);
+
+            Dst[8] = (uint8_t)((Dst[8] & ~Low) | (uint8_t)(Raw << Span.Shift));
+            Word = (Word & ~(Mask >> (8u - Span.Shift))) | (Raw >> (8u - Span.Shift));
+            CC_Signal_StoreBE(Dst, 8u, Word);
+        }
+        else
+        {
+            uint64_t Word = CC_Signal_LoadBE(Dst, Span.Bytes);
+
+            Word = (Word & ~(Mask << Span.Shift)) | (Raw << Span.Shift);
+            CC_Signal_StoreBE(Dst, Span.Bytes, Word);
+        }
+    }
+}
+
+/**
+ * @brief Extracts the physical value of a signal.
+ *
+ * @param[in] Sig Pointer to the signal descriptor.
+ * @param[in] Data Pointer to the payload.
+ * @return CC_SIG_PHYS_t Physical value.
+ */
+CC_SIG_PHYS_t CC_Signal_Get(const CC_signal_t *Sig, const uint8_t *Data)
+{
+    uint64_t Raw = CC_Signal_GetRaw(Sig, Data);
+    CC_SIG_PHYS_t Value;
+
+    if (Sig->Signed && (0u != (Raw >> (Sig->Length - 1u))))
+    {
+        Value = -(CC_SIG_PHYS_t)(~Raw & CC_Signal_Mask(Sig->Length)) - (CC_SIG_PHYS_t)1;
+    }
+    else
+    {
+        Value = (CC_SIG_PHYS_t)Raw;
+    }
+    return Value * Sig->Scale + Sig->Offset;
+}
+
+/**
+ * @brief Inserts the physical value of a signal.
+ *
+ * @param[in] Sig Pointer to the signal descriptor.
+ * @param[in,out] Data Pointer to the payload.
+ * @param[in] Value Physical value.
+ */
+void CC_Signal_Set(const CC_signal_t *Sig, uint8_t *Data, CC_SIG_PHYS_t Value)
+{
+    assert((NULL != Sig) && (0 != Sig->Scale));
+
+    CC_SIG_PHYS_t Scaled = (Value - Sig->Offset) / Sig->Scale;
+    uint64_t Mask = CC_Signal_Mask(Sig->Length);
+    uint64_t Raw;
+
+    Scaled += (Scaled >= 0) ? (CC_SIG_PHYS_t)0.5 : (CC_SIG_PHYS_t)-0.5;
+
+    if (Sig->Signed)
+    {
+        uint64_t Max = Mask >> 1;
+
+        if (Scaled >= (CC_SIG_PHYS_t)Max)
+        {
+            Raw = Max;
+        }
+        else if (Scaled <= -(CC_SIG_PHYS_t)Max - (CC_SIG_PHYS_t)1)
+        {
+            Raw = Max + 1u;
+        }
+        else if (Scaled < 0)
+        {
+            Raw = ~(uint64_t)(-Scaled) + 1u;
+        }
+        else
+        {
+            Raw = (uint64_t)Scaled;
+        }
+    }
+    else
+    {
+        if (Scaled >= (CC_SIG_PHYS_t)Mask)
+        {
+            Raw = Mask;
+        }
+        else if (Scaled < 1)
+        {
+            Raw = 0;
+        }
+        else
+        {
+            Raw = (uint64_t)Scaled;
+        }
+    }
+    CC_Signal_SetRaw(Sig, Data, Raw);
+}
+
+/**
+ * @brief Computes the mask of the payload bytes covered by a signal.
+ *
+ * @param[in] Sig Pointer to the signal descriptor.
+ * @return uint64_t Byte mask (bit `i` = payload byte `i`).
+ */
+static inline uint64_t CC_Signal_ByteMask(const CC_signal_t *Sig)
+{
+    CC_sig_span_t Span;
+
+    CC_Signal_Span(Sig, &Span);
+    return CC_Signal_Mask(Span.Bytes) << Span.First;
+}
+
+/**
+ * @brief Initializes the change tracking of a message.
+ *
+ * @param[out] Msg Pointer to the message to initialize.
+ * @param[in] Signals Pointer to the signal descriptors.
+ * @param[in] Count Number of signals (at most 64).
+ * @param[in] Last Pointer to `Len` bytes of storage for the last payload.
+ * @param[in] Len Payload length in bytes (at most CC_MAX_DATA_LEN).
+ */
+void CC_Signal_Msg_init(CC_signal_msg_t *Msg, const CC_signal_t *Signals, uint8_t Count, uint8_t *Last,
+                        uint8_t Len)
+{
+    assert((NULL != Msg) && ((NULL != Signals) || (0 == Count)) && (Count <= 64u) && (NULL != Last) &&
+           (Len <= CC_MAX_DATA_LEN));
+
+    Msg->Signals = Signals;
+    Msg->Count = Count;
+    Msg->Len = Len;
+    Msg->Valid = 0;
+    Msg->Last = Last;
+}
+
+/**
+ * @brief Decodes the signals of a received payload whose bytes changed.
+ *
+ * @param[in,out] Msg Pointer to the message.
+ * @param[in] Data Pointer to the received payload.
+ * @param[in,out] Values Pointer to the physical values of the signals.
+ * @return uint64_t Bitmask of the updated signals.
+ */
+uint64_t CC_Signal_Msg_Update(CC_signal_msg_t *Msg, const uint8_t *Data, CC_SIG_PHYS_t *Values)
+{
+    assert((NULL != Msg) && (NULL != Data) && (NULL != Values));
+
+    uint64_t Changed = 0;
+    uint64_t Updated = 0;
+
+    if (Msg->Valid)
+    {
+        for (uint8_t i = 0; i < Msg->Len; i++)
+        {
+            if (Data[i] != Msg->Last[i])
+            {
+                Changed |= (uint64_t)1u << i;
+                Msg->Last[i] = Data[i];
+            }
+        }
+        if (0u == Changed)
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        for (uint8_t i = 0; i < Msg->Len; i++)
+        {
+            Msg->Last[i] = Data[i];
+        }
+        Msg->Valid = 1;
+        Changed = UINT64_MAX;
+    }
+
+    for (uint8_t i = 0; i < Msg->Count; i++)
+    {
+        if (0u != (CC_Signal_ByteMask(&Msg->Signals[i]) & Changed))
+        {
+            Values[i] = CC_Signal_Get(&Msg->Signals[i], Data);
+            Updated |= (uint64_t)1u << i;
+        }
+    }
+    return Updated;
+}
+
+/**
+ * @brief Encodes all signals of a message into a payload.
+ *
+ * @param[in] Msg Pointer to the message.
+ * @param[in,out] Data Pointer to the payload to update.
+ * @param[in] Values Pointer to the physical values of the signals.
+ */
+void CC_Signal_Msg_Pack(const CC_signal_msg_t *Msg, uint8_t *Data, const CC_SIG_PHYS_t *Values)
+{
+    assert((NULL != Msg) && (NULL != Data) && (NULL != Values));
+
+    for (uint8_t i = 0; i < Msg->Count; i++)
+    {
+        CC_Signal_Set(&Msg->Signals[i], Data, Values[i]);
+    }
+}
@@ -0,0 +1,165 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef CAN_SIGNAL_H_
+#define CAN_SIGNAL_H_
+
+#include "can_core.h"
+
+/**
+ * @def CC_SIGNAL_PHYS_TYPE
+ * @brief Floating-point type of physical signal values.
+ *
+ * Defaults to `float`, which most MCU FPUs handle natively. Define it as `double`
+ * before including this header (and when building can_signal.c) for more precision.
+ */
+#ifndef CC_SIGNAL_PHYS_TYPE
+#define CC_SIGNAL_PHYS_TYPE float
+#endif
+
+typedef CC_SIGNAL_PHYS_TYPE CC_SIG_PHYS_t;
+
+/**
+ * @brief Byte order of a signal, as in DBC files.
+ *
+ * Values:
+ * - CC_SIG_MOTOROLA: Big endian. `StartBit` is the most significant bit of the signal.
+ * - CC_SIG_INTEL: Little endian. `StartBit` is the least significant bit of the signal.
+ *
+ * Bits are numbered as in DBC files: bit `n` is bit `n % 8` of payload byte `n / 8`.
+ */
+typedef enum
+{
+    CC_SIG_MOTOROLA = 0,
+    CC_SIG_INTEL
+} CC_sig_order_t;
+
+/**
+ * @brief Descriptor of a signal within a CAN payload.
+ *
+ * Physical value = raw value * Scale + Offset.
+ *
+ * Fields:
+ * - StartBit: Start bit of the signal (see CC_sig_order_t).
+ * - Length: Length of the signal in bits (1-64).
+ * - Order: Byte order, see CC_sig_order_t.
+ * - Signed: Non-zero if the raw value is a two's complement number.
+ * - Scale: Factor applied to the raw value.
+ * - Offset: Offset added to the scaled value.
+ */
+typedef struct
+{
+    uint16_t StartBit;
+    uint8_t Length;
+    uint8_t Order;
+    uint8_t Signed;
+    CC_SIG_PHYS_t Scale;
+    CC_SIG_PHYS_t Offset;
+} CC_signal_t;
+
+/**
+ * @brief Signals of one message together with the last payload decoded for it.
+ *
+ * Fields:
+ * - Signals: Array of signal descriptors.
+ * - Count: Number of signals (at most 64).
+ * - Len: Number of payload bytes compared between frames (at most CC_MAX_DATA_LEN).
+ * - Valid: Set once Last holds a payload.
+ * - Last: Copy of the last payload, `Len` bytes provided by the caller.
+ */
+typedef struct
+{
+    const CC_signal_t *Signals;
+    uint8_t Count;
+    uint8_t Len;
+    uint8_t Valid;
+    uint8_t *Last;
+} CC_signal_msg_t;
+
+/**
+ * @brief Extracts the raw value of a signal.
+ *
+ * The bytes covering the signal are assembled into one word, and the value is taken
+ * out with a single shift and mask.
+ *
+ * @param Sig Pointer to the signal descriptor.
+ * @param Data Pointer to the payload.
+ * @return uint64_t Raw value, not sign extended.
+ */
+uint64_t CC_Signal_GetRaw(const CC_signal_t *Sig, const uint8_t *Data);
+
+/**
+ * @brief Inserts the raw value of a signal, leaving the other payload bits untouched.
+ *
+ * @param Sig Pointer to the signal descriptor.
+ * @param Data Pointer to the payload.
+ * @param Raw Raw value; bits above the signal length are ignored.
+ */
+void CC_Signal_SetRaw(const CC_signal_t *Sig, uint8_t *Data, uint64_t Raw);
+
+/**
+ * @brief Extracts the physical value of a signal.
+ *
+ * @param Sig Pointer to the signal descriptor.
+ * @param Data Pointer to the payload.
+ * @return CC_SIG_PHYS_t Physical value.
+ */
+CC_SIG_PHYS_t CC_Signal_Get(const CC_signal_t *Sig, const uint8_t *Data);
+
+/**
+ * @brief Inserts the physical value of a signal.
+ *
+ * The value is rounded to the nearest raw value and saturated to the range
+ * of the signal.
+ *
+ * @param Sig Pointer to the signal descriptor.
+ * @param Data Pointer to the payload.
+ * @param Value Physical value.
+ */
+void CC_Signal_Set(const CC_signal_t *Sig, uint8_t *Data, CC_SIG_PHYS_t Value);
+
+/**
+ * @brief Initializes the change tracking of a message.
+ *
+ * @param Msg Pointer to the message to initialize.
+ * @param Signals Pointer to the signal descriptors.
+ * @param Count Number of signals (at most 64).
+ * @param Last Pointer to `Len` bytes of storage for the last payload.
+ * @param Len Payload length in bytes (at most CC_MAX_DATA_LEN).
+ */
+void CC_Signal_Msg_init(CC_signal_msg_t *Msg, const CC_signal_t *Signals, uint8_t Count, uint8_t *Last,
+                        uint8_t Len);
+
+/**
+ * @brief Decodes the signals of a received payload whose bytes changed.
+ *
+ * Compares the payload with the last one of the message and decodes only the
+ * signals covering a changed byte; all signals are decoded on the first call.
+ * Typically called from the RX table `Parser` of the message.
+ *
+ * @param Msg Pointer to the message.
+ * @param Data Pointer to the received payload, at least `Len` bytes.
+ * @param Values Pointer to an array of `Count` physical values, updated in place.
+ * @return uint64_t Bitmask of the updated signals (bit `i` = signal `i`).
+ */
+uint64_t CC_Signal_Msg_Update(CC_signal_msg_t *Msg, const uint8_t *Data, CC_SIG_PHYS_t *Values);
+
+/**
+ * @brief Encodes all signals of a message into a payload.
+ *
+ * Typically called from the TX table `Parser` on the entry `Data`.
+ *
+ * @param Msg Pointer to the message.
+ * @param Data Pointer to the payload to update.
+ * @param Values Pointer to an array of `Count` physical values.
+ */
+void CC_Signal_Msg_Pack(const CC_signal_msg_t *Msg, uint8_t *Data, const CC_SIG_PHYS_t *Values);
+
+#endif /* CAN_SIGNAL_H_ */
@@ -0,0 +1,214 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef CAN_TABLE_GEN_H_
+#define CAN_TABLE_GEN_H_
+
+#include "can_core.h"
+
+/**
+ * @file can_table_gen.h
+ * @brief Compile-time generation of RX/TX tables from X-macro lists.
+ *
+ * A table is described once as a list macro taking the generator `X` as parameter,
+ * with one `X(...)` line per message:
+ *
+ * @code
+ * #define APP_RX_TABLE(X)                                          \
+ *     X(RX_ENGINE, 0x100, 0, 0, 8, 100, Parse_Engine)              \
+ *     X(RX_BRAKES, 0x18FF0010, 1, 0, 8, 50, Parse_Brakes)
+ *
+ * #define APP_TX_TABLE(X)                                          \
+ *     X(TX_STATUS, 0x200, 0, 0, 8, 10, StatusData, Prepare_Status)
+ *
+ * CC_RX_TABLE_SLOTS(AppRx, APP_RX_TABLE)   // enum RX_ENGINE, RX_BRAKES, AppRx_COUNT
+ * CC_RX_TABLE_DEFINE(AppRx, APP_RX_TABLE)  // AppRx[] and AppRx_Dispatch()
+ * CC_TX_TABLE_SLOTS(AppTx, APP_TX_TABLE)
+ * CC_TX_TABLE_DEFINE(AppTx, APP_TX_TABLE)
+ *
+ * CC_RX_init(&Rx, RxBuf, RX_BUF_SIZE, AppRx, AppRx_COUNT, OnUnreg, OnTimeout);
+ * CC_RX_dispatch_function_register(&Rx, AppRx_Dispatch);
+ * @endcode
+ *
+ * RX columns: slot name, ID, IDE_flag, FDF_flag, DLC, TimeOut, Parser.
+ * TX columns: slot name, ID, IDE_flag, FDF_flag, DLC, SendFreq, Data, Parser.
+ *
+ * The slot name becomes an enumerator holding the table position, which is also used
+ * as `SlotNo`. All columns except the parsers and the TX data must be integer constant
+ * expressions. The generated tables are ordinary, writable tables, so fields without
+ * a column (e.g. `Mode` or `Offset`) can be set before CC_RX_init/CC_TX_init.
+ *
+ * The following mistakes fail to compile:
+ * - Two entries of a table with the same (IDE, ID) pair (duplicate case value).
+ * - A classic frame with DLC above 8, or any DLC above 15.
+ * - An FD entry without CC_FD_SUPPORT.
+ *
+ * The generated RX dispatch switches on the (IDE, ID) key and calls the parsers
+ * directly, so static parsers visible in the same translation unit can be inlined.
+ */
+
+/**
+ * @def CC_RX_KEY
+ * @brief Lookup key of an (ID, IDE) pair as an integer constant expression.
+ */
+#define CC_RX_KEY(Id, Ide) ((((uint32_t)(Ide) & 1u) << 31) | ((uint32_t)(Id) & 0x1FFFFFFFu))
+
+/**
+ * @def CC_GEN_FDF_INIT
+ * @brief Designated initializer of the FD format flag, empty without CC_FD_SUPPORT.
+ */
+#if CC_FD_SUPPORT
+#define CC_GEN_FDF_INIT(Fdf) .FDF_flag = (Fdf),
+#else
+#define CC_GEN_FDF_INIT(Fdf)
+#endif
+
+/**
+ * @brief Reads the FD format flag of a received message.
+ *
+ * @param Msg Pointer to the message.
+ * @return uint8_t FD format flag, always 0 without CC_FD_SUPPORT.
+ */
+static inline uint8_t CC_Gen_MsgFdf(const CC_RX_message_t *Msg)
+{
+#if CC_FD_SUPPORT
+    return Msg->FDF_flag;
+#else
+    (void)Msg;
+    return 0;
+#endif
+}
+
+/**
+ * @def CC_GEN_CHECK
+ * @brief Compile-time check of one table entry, C99 compatible.
+ */
+#define CC_GEN_CHECK(Name, Fdf, Dlc)                                                                           \
+    typedef char CC_gen_check_##Name[((((Dlc) <= 8u) || (((Fdf) != 0) && ((Dlc) <= 15u))) &&                   \
+                                      (((Fdf) == 0) || (CC_FD_SUPPORT != 0)))                                  \
+                                         ? 1                                                                   \
+                                         : -1];
+
+/* RX generators */
+#define CC_GEN_RX_SLOT(Name, Id, Ide, Fdf, Dlc, TimeOutTicks, ParserFn) Name,
+
+#define CC_GEN_RX_ENTRY(Name, Id, Ide, Fdf, Dlc, TimeOutTicks, ParserFn)                                       \
+    {.SlotNo = (Name),                                                                                         \
+     .ID = (Id),                                                                                               \
+     .DLC = (Dlc),                                                                                             \
+     .IDE_flag = (Ide),                                                                                        \
+     CC_GEN_FDF_INIT(Fdf).TimeOut = (TimeOutTicks),                                                            \
+     .Parser = (ParserFn)},
+
+#define CC_GEN_RX_CHECK(Name, Id, Ide, Fdf, Dlc, TimeOutTicks, ParserFn) CC_GEN_CHECK(Name, Fdf, Dlc)
+
+#define CC_GEN_RX_CASE(Name, Id, Ide, Fdf, Dlc, TimeOutTicks, ParserFn)                                        \
+    case CC_RX_KEY(Id, Ide):                                                                                   \
+        if ((Msg->DLC == (Dlc)) && (CC_Gen_MsgFdf(Msg) == (Fdf)))                                              \
+        {                                                                                                      \
+            ParserFn(Instance, Msg, Name);                                                                     \
+            return Name;                                                                                       \
+        }                                                                                                      \
+        break;
+
+/**
+ * @def CC_RX_TABLE_SLOTS
+ * @brief Declares the slot enumerators of an RX table and `Table##_COUNT`.
+ *
+ * Expand once per program, e.g. in a header shared by the parsers.
+ */
+#define CC_RX_TABLE_SLOTS(Table, LIST)                                                                         \
+    enum                                                                                                       \
+    {                                                                                                          \
+        LIST(CC_GEN_RX_SLOT) Table##_COUNT                                                                     \
+    };
+
+/**
+ * @def CC_RX_TABLE_DEFINE
+ * @brief Defines an RX table and its dispatch function.
+ *
+ * Expands to the checks of all entries, the table `CC_RX_table_t Table[Table##_COUNT]`,
+ * the static helper `Table##_Match` returning the matched slot (or `Table##_COUNT`), and
+ * the static function `Table##_Dispatch` for CC_RX_dispatch_function_register.
+ * Expand in one source file, after CC_RX_TABLE_SLOTS and the parser declarations.
+ */
+#define CC_RX_TABLE_DEFINE(Table, LIST)                                                                        \
+    LIST(CC_GEN_RX_CHECK)                                                                                      \
+    CC_RX_table_t Table[Table##_COUNT] = {LIST(CC_GEN_RX_ENTRY)};                                              \
+                                                                                                               \
+    static inline uint16_t Table##_Match(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg)               \
+    {                                                                                                          \
+        switch (CC_RX_KEY(Msg->ID, Msg->IDE_flag))                                                             \
+        {                                                                                                      \
+            LIST(CC_GEN_RX_CASE)                                                                               \
+        default:                                                                                               \
+            break;                                                                                             \
+        }                                                                                                      \
+        return Table##_COUNT;                                                                                  \
+    }                                                                                                          \
+                                                                                                               \
+    static CC_RX_table_t *Table##_Dispatch(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg)             \
+    {                                                                                                          \
+        uint16_t Slot = Table##_Match(Instance, Msg);                                                          \
+                                                                                                               \
+        return (Slot < Table##_COUNT) ? &Table[Slot] : NULL;                                                   \
+    }
+
+/* TX generators */
+#define CC_GEN_TX_SLOT(Name, Id, Ide, Fdf, Dlc, SendTicks, DataBuf, ParserFn) Name,
+
+#define CC_GEN_TX_ENTRY(Name, Id, Ide, Fdf, Dlc, SendTicks, DataBuf, ParserFn)                                 \
+    {.SlotNo = (Name),                                                                                         \
+     .ID = (Id),                                                                                               \
+     .Data = (DataBuf),                                                                                        \
+     .DLC = (Dlc),                                                                                             \
+     .IDE_flag = (Ide),                                                                                        \
+     CC_GEN_FDF_INIT(Fdf).SendFreq = (SendTicks),                                                              \
+     .Parser = (ParserFn)},
+
+#define CC_GEN_TX_CHECK(Name, Id, Ide, Fdf, Dlc, SendTicks, DataBuf, ParserFn)                                 \
+    CC_GEN_CHECK(Name, Fdf, Dlc)
+
+#define CC_GEN_TX_CASE(Name, Id, Ide, Fdf, Dlc, SendTicks, DataBuf, ParserFn)                                  \
+    case CC_RX_KEY(Id, Ide):                                                                                   \
+        break;
+
+/**
+ * @def CC_TX_TABLE_SLOTS
+ * @brief Declares the slot enumerators of a TX table and `Table##_COUNT`.
+ */
+#define CC_TX_TABLE_SLOTS(Table, LIST)                                                                         \
+    enum                                                                                                       \
+    {                                                                                                          \
+        LIST(CC_GEN_TX_SLOT) Table##_COUNT                                                                     \
+    };
+
+/**
+ * @def CC_TX_TABLE_DEFINE
+ * @brief Defines a TX table.
+ *
+ * Expands to the checks of all entries and the table `CC_TX_table_t Table[Table##_COUNT]`.
+ * The static helper `Table##_IdCheck` only exists to reject duplicate IDs and is never called.
+ */
+#define CC_TX_TABLE_DEFINE(Table, LIST)                                                                        \
+    LIST(CC_GEN_TX_CHECK)                                                                                      \
+    CC_TX_table_t Table[Table##_COUNT] = {LIST(CC_GEN_TX_ENTRY)};                                              \
+                                                                                                               \
+    static inline void Table##_IdCheck(uint32_t Key)                                                           \
+    {                                                                                                          \
+        switch (Key)                                                                                           \
+        {                                                                                                      \
+            LIST(CC_GEN_TX_CASE)                                                                               \
+        default:                                                                                               \
+            break;                                                                                             \
+        }                                                                                                      \
+    }
+
+#endif /* CAN_TABLE_GEN_H_ */
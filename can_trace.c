@@ -0,0 +1,292 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#include "can_trace.h"
+#include "assert.h"
+#include <stddef.h>
+
+#if CC_TRACE
+
+/**
+ * @brief Fills the header of a capture file written by this build.
+ *
+ * @param[out] Header Pointer to the header to fill.
+ */
+void CC_Trace_FileHeader(CC_trace_file_t *Header)
+{
+    assert(NULL != Header);
+
+    Header->Magic = CC_TRACE_MAGIC;
+    Header->Version = CC_TRACE_VERSION;
+    Header->RecordSize = (uint16_t)sizeof(CC_trace_record_t);
+    Header->Flags = CC_FD_SUPPORT ? CC_TRACE_FILE_FD : 0u;
+    Header->Reserved = 0;
+}
+
+/**
+ * @brief Checks that the records of a capture file can be read by this build.
+ *
+ * @param[in] Header Pointer to the header of the file.
+ * @return uint8_t Non-zero if the magic, version and record layout match.
+ */
+uint8_t CC_Trace_FileCheck(const CC_trace_file_t *Header)
+{
+    assert(NULL != Header);
+
+    CC_trace_file_t Own;
+
+    CC_Trace_FileHeader(&Own);
+    return (uint8_t)((Own.Magic == Header->Magic) && (Own.Version == Header->Version) &&
+                     (Own.RecordSize == Header->RecordSize) && (Own.Flags == Header->Flags));
+}
+
+/**
+ * @brief Initializes a replay in fast mode.
+ *
+ * @param[out] Replay Pointer to the replay.
+ * @param[in] Records Pointer to the captured records.
+ * @param[in] Count Number of records.
+ * @param[in] Channel Channel whose records are replayed, or CC_REPLAY_ALL_CHANNELS.
+ */
+void CC_Replay_init(CC_replay_t *Replay, const CC_trace_record_t *Records, uint32_t Count, uint8_t Channel)
+{
+    assert((NULL != Replay) && ((NULL != Records) || (0 == Count)));
+
+    Replay->Records = Records;
+    Replay->Count = Count;
+    Replay->Pos = 0;
+    Replay->Channel = Channel;
+    Replay->Realtime = 0;
+    Replay->Started = 0;
+    Replay->UnitsPerTick = 1;
+    Replay->Base = 0;
+    Replay->Elapsed = 0;
+    Replay->Last = 0;
+    Replay->Pushed = 0;
+}
+
+/**
+ * @brief Switches a replay to the original timing of the records.
+ *
+ * @param[in,out] Replay Pointer to the replay.
+ * @param[in] UnitsPerTick Record time units per system tick (at least 1).
+ */
+void CC_Replay_Realtime_init(CC_replay_t *Replay, uint32_t UnitsPerTick)
+{
+    assert((NULL != Replay) && (0 != UnitsPerTick));
+
+    Replay->Realtime = 1;
+    Replay->Started = 0;
+    Replay->UnitsPerTick = UnitsPerTick;
+}
+
+/**
+ * @brief Helper function to advance a replay to its next record to push.
+ *
+ * Skips transmitted records and records of other channels.
+ *
+ * @param[in,out] Replay Pointer to the replay.
+ * @return const CC_trace_record_t* Pointer to the next record, or NULL once the replay is done.
+ */
+static inline const CC_trace_record_t *CC_Replay_Next(CC_replay_t *Replay)
+{
+    while (Replay->Pos < Replay->Count)
+    {
+        const CC_trace_record_t *Rec = &Replay->Records[Replay->Pos];
+
+        if ((0 == (Rec->Flags & CC_TRACE_TX)) &&
+            ((CC_REPLAY_ALL_CHANNELS == Replay->Channel) || (Rec->Channel == Replay->Channel)))
+        {
+            return Rec;
+        }
+        Replay->Pos++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Helper function to compute the system tick offset of a record from the first one.
+ *
+ * @param[in] Replay Pointer to the replay.
+ * @param[in] Rec Pointer to the record.
+ * @return uint64_t Ticks after the first replayed record; records older than it are due at once.
+ */
+static inline uint64_t CC_Replay_Offset(const CC_replay_t *Replay, const CC_trace_record_t *Rec)
+{
+    return (Rec->Time > Replay->Base) ? ((Rec->Time - Replay->Base) / Replay->UnitsPerTick) : 0u;
+}
+
+/**
+ * @brief Helper function to advance the replay clock to the current tick.
+ *
+ * @param[in,out] Replay Pointer to the replay.
+ * @param[in] Rec Pointer to the next record.
+ * @param[in] Now Current system tick.
+ */
+static inline void CC_Replay_Clock(CC_replay_t *Replay, const CC_trace_record_t *Rec, CC_TIME_VAL_t Now)
+{
+    if (0 == Replay->Started)
+    {
+        Replay->Started = 1;
+        Replay->Base = Rec->Time;
+        Replay->Elapsed = 0;
+    }
+    else
+    {
+        Replay->Elapsed += (CC_TIME_VAL_t)(Now - Replay->Last);
+    }
+    Replay->Last = Now;
+}
+
+/**
+ * @brief Helper function to push one record into an RX instance.
+ *
+ * The payload is only read by the push functions.
+ *
+ * @param[in,out] Rx Pointer to the RX instance.
+ * @param[in] Rec Pointer to the record.
+ */
+static inline void CC_Replay_Push(CC_RX_instance_t *Rx, const CC_trace_record_t *Rec)
+{
+    uint8_t *Data = (uint8_t *)Rec->Data;
+    uint8_t DLC = Rec->DLC & 0x0Fu;
+    uint8_t IDE_flag = (uint8_t)(0 != (Rec->Flags & CC_TRACE_IDE));
+
+#if CC_FD_SUPPORT
+    if (0 != (Rec->Flags & CC_TRACE_FDF))
+    {
+        uint8_t BRS_flag = (uint8_t)(0 != (Rec->Flags & CC_TRACE_BRS));
+        uint8_t ESI_flag = (uint8_t)(0 != (Rec->Flags & CC_TRACE_ESI));
+
+#if CC_RX_HW_TIMESTAMP
+        if (0 != (Rec->Flags & CC_TRACE_HWTIME))
+        {
+            CC_RX_PushMsgFDTs(Rx, Rec->ID, Data, DLC, IDE_flag, BRS_flag, ESI_flag, Rec->Time);
+            return;
+        }
+#endif
+        CC_RX_PushMsgFD(Rx, Rec->ID, Data, DLC, IDE_flag, BRS_flag, ESI_flag);
+        return;
+    }
+#endif
+#if CC_RX_HW_TIMESTAMP
+    if (0 != (Rec->Flags & CC_TRACE_HWTIME))
+    {
+        CC_RX_PushMsgTs(Rx, Rec->ID, Data, DLC, IDE_flag, Rec->Time);
+        return;
+    }
+#endif
+    CC_RX_PushMsg(Rx, Rec->ID, Data, DLC, IDE_flag);
+}
+
+/**
+ * @brief Pushes the next records into an RX instance.
+ *
+ * In fast mode, the number of records is bounded by the free receive buffer slots
+ * counted once per call, so frames taken by mailboxes or ISR routes may leave slots
+ * unused until the next call.
+ *
+ * @param[in,out] Replay Pointer to the replay.
+ * @param[in,out] Rx Pointer to the RX instance.
+ * @param[in] Now Current system tick.
+ * @return uint32_t Number of records pushed by this call.
+ */
+uint32_t CC_Replay_Step(CC_replay_t *Replay, CC_RX_instance_t *Rx, CC_TIME_VAL_t Now)
+{
+    assert((NULL != Replay) && (NULL != Rx));
+
+    const CC_trace_record_t *Rec = CC_Replay_Next(Replay);
+    uint32_t Pushed = 0;
+
+    if (NULL == Rec)
+    {
+        return 0;
+    }
+
+    if (0 != Replay->Realtime)
+    {
+        CC_Replay_Clock(Replay, Rec, Now);
+
+        while ((NULL != Rec) && (CC_Replay_Offset(Replay, Rec) <= Replay->Elapsed) && (0 != CC_RX_FreeCount(Rx)))
+        {
+            CC_Replay_Push(Rx, Rec);
+            Replay->Pos++;
+            Pushed++;
+            Rec = CC_Replay_Next(Replay);
+        }
+    }
+    else
+    {
+        uint16_t Free = CC_RX_FreeCount(Rx);
+
+        while ((NULL != Rec) && (Pushed < Free))
+        {
+            CC_Replay_Push(Rx, Rec);
+            Replay->Pos++;
+            Pushed++;
+            Rec = CC_Replay_Next(Replay);
+        }
+    }
+
+    Replay->Pushed += Pushed;
+    return Pushed;
+}
+
+/**
+ * @brief Returns the time until the next record of a realtime replay is due.
+ *
+ * @param[in,out] Replay Pointer to the replay.
+ * @param[in] Now Current system tick.
+ * @return CC_TIME_VAL_t System ticks until the next record, 0 if a record is due or in
+ *         fast mode, or CC_MAX_TIMEOUT once the replay is done.
+ */
+CC_TIME_VAL_t CC_Replay_NextEvent(CC_replay_t *Replay, CC_TIME_VAL_t Now)
+{
+    assert(NULL != Replay);
+
+    const CC_trace_record_t *Rec = CC_Replay_Next(Replay);
+
+    if (NULL == Rec)
+    {
+        return (CC_TIME_VAL_t)CC_MAX_TIMEOUT;
+    }
+    if ((0 == Replay->Realtime) || (0 == Replay->Started))
+    {
+        return 0;
+    }
+
+    uint64_t Elapsed = Replay->Elapsed + (CC_TIME_VAL_t)(Now - Replay->Last);
+    uint64_t Offset = CC_Replay_Offset(Replay, Rec);
+
+    if (Offset <= Elapsed)
+    {
+        return 0;
+    }
+    return ((Offset - Elapsed) < (uint64_t)CC_MAX_TIMEOUT) ? (CC_TIME_VAL_t)(Offset - Elapsed)
+                                                           : (CC_TIME_VAL_t)CC_MAX_TIMEOUT;
+}
+
+/**
+ * @brief Checks whether all records of a replay have been pushed.
+ *
+ * Records skipped by the filter at the end of the capture are counted as pushed
+ * only after the next CC_Replay_Step or CC_Replay_NextEvent call.
+ *
+ * @param[in] Replay Pointer to the replay.
+ * @return uint8_t Non-zero once the replay is done.
+ */
+uint8_t CC_Replay_Done(const CC_replay_t *Replay)
+{
+    assert(NULL != Replay);
+
+    return (uint8_t)(Replay->Pos >= Replay->Count);
+}
+
+#endif /* CC_TRACE */
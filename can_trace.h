@@ -0,0 +1,170 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+#ifndef CAN_TRACE_H_
+#define CAN_TRACE_H_
+
+#include "can_core.h"
+
+#if CC_TRACE
+
+/**
+ * @def CC_TRACE_MAGIC
+ * @brief Magic number of a capture file ("CCTR" in file byte order on little-endian targets).
+ */
+#define CC_TRACE_MAGIC 0x52544343u
+
+/**
+ * @def CC_TRACE_VERSION
+ * @brief Version of the capture file format.
+ */
+#define CC_TRACE_VERSION 1u
+
+/**
+ * @def CC_TRACE_FILE_FD
+ * @brief Capture file flag: records were written by a CC_FD_SUPPORT build.
+ */
+#define CC_TRACE_FILE_FD 0x01u
+
+/**
+ * @brief Header of a capture file.
+ *
+ * A capture file is this header followed by the CC_trace_record_t records exactly as
+ * returned by CC_Trace_Peek, in the byte order of the capturing target.
+ *
+ * Fields:
+ * - Magic: CC_TRACE_MAGIC.
+ * - Version: CC_TRACE_VERSION.
+ * - RecordSize: sizeof(CC_trace_record_t) of the capturing build.
+ * - Flags: Combination of the CC_TRACE_FILE_* flags.
+ * - Reserved: Always 0.
+ */
+typedef struct
+{
+    uint32_t Magic;
+    uint16_t Version;
+    uint16_t RecordSize;
+    uint32_t Flags;
+    uint32_t Reserved;
+} CC_trace_file_t;
+
+/**
+ * @def CC_REPLAY_ALL_CHANNELS
+ * @brief Channel filter of CC_Replay_init replaying the records of every channel.
+ */
+#define CC_REPLAY_ALL_CHANNELS 0xFFu
+
+/**
+ * @brief Replay of captured records into an RX instance.
+ *
+ * Fields:
+ * - Records: Pointer to the captured records, e.g. a memory-mapped capture file.
+ * - Count: Number of records.
+ * - Pos: Index of the next record to replay.
+ * - Channel: Channel whose records are replayed, or CC_REPLAY_ALL_CHANNELS.
+ * - Realtime: Non-zero to replay at the original timing, see CC_Replay_Realtime_init.
+ * - Started: Set once the first record has been replayed in realtime mode.
+ * - UnitsPerTick: Record time units per system tick, realtime mode only.
+ * - Base: Time of the first replayed record, realtime mode only.
+ * - Elapsed: System ticks since the first record was replayed, realtime mode only.
+ * - Last: System tick of the last CC_Replay_Step call, realtime mode only.
+ * - Pushed: Number of records pushed so far.
+ */
+typedef struct
+{
+    const CC_trace_record_t *Records;
+    uint32_t Count;
+    uint32_t Pos;
+    uint8_t Channel;
+    uint8_t Realtime;
+    uint8_t Started;
+    uint32_t UnitsPerTick;
+    uint64_t Base;
+    uint64_t Elapsed;
+    CC_TIME_VAL_t Last;
+    uint32_t Pushed;
+} CC_replay_t;
+
+/**
+ * @brief Fills the header of a capture file written by this build.
+ *
+ * @param Header Pointer to the header to fill.
+ */
+void CC_Trace_FileHeader(CC_trace_file_t *Header);
+
+/**
+ * @brief Checks that the records of a capture file can be read by this build.
+ *
+ * @param Header Pointer to the header of the file.
+ * @return uint8_t Non-zero if the magic, version and record layout match.
+ */
+uint8_t CC_Trace_FileCheck(const CC_trace_file_t *Header);
+
+/**
+ * @brief Initializes a replay in fast mode.
+ *
+ * Records captured on transmission (CC_TRACE_TX) are skipped.
+ *
+ * @param Replay Pointer to the replay.
+ * @param Records Pointer to the captured records.
+ * @param Count Number of records.
+ * @param Channel Channel whose records are replayed, or CC_REPLAY_ALL_CHANNELS.
+ */
+void CC_Replay_init(CC_replay_t *Replay, const CC_trace_record_t *Records, uint32_t Count, uint8_t Channel);
+
+/**
+ * @brief Switches a replay to the original timing of the records.
+ *
+ * The first replayed record is pushed at once, and every following record when as
+ * much system time has passed as between the two captures. CC_Replay_Step must then
+ * be called at least once per wrap period of the system tick.
+ *
+ * @param Replay Pointer to the replay.
+ * @param UnitsPerTick Record time units per system tick: 1 for records stamped with
+ *        the system tick, e.g. 1000 for microsecond hardware timestamps and a 1 ms tick.
+ */
+void CC_Replay_Realtime_init(CC_replay_t *Replay, uint32_t UnitsPerTick);
+
+/**
+ * @brief Pushes the next records into an RX instance.
+ *
+ * In fast mode, records are pushed while the receive buffer has free slots; in
+ * realtime mode, every record that is due at `Now`. Records stamped with a hardware
+ * timestamp keep it with CC_RX_HW_TIMESTAMP. Must be called from the pushing
+ * context of the instance, typically in a loop with CC_RX_Poll.
+ *
+ * @param Replay Pointer to the replay.
+ * @param Rx Pointer to the RX instance.
+ * @param Now Current system tick.
+ * @return uint32_t Number of records pushed by this call.
+ */
+uint32_t CC_Replay_Step(CC_replay_t *Replay, CC_RX_instance_t *Rx, CC_TIME_VAL_t Now);
+
+/**
+ * @brief Returns the time until the next record of a realtime replay is due.
+ *
+ * @param Replay Pointer to the replay.
+ * @param Now Current system tick.
+ * @return CC_TIME_VAL_t System ticks until the next record, 0 if a record is due or in
+ *         fast mode, or CC_MAX_TIMEOUT once the replay is done.
+ */
+CC_TIME_VAL_t CC_Replay_NextEvent(CC_replay_t *Replay, CC_TIME_VAL_t Now);
+
+/**
+ * @brief Checks whether all records of a replay have been pushed.
+ *
+ * @param Replay Pointer to the replay.
+ * @return uint8_t Non-zero once the replay is done.
+ */
+uint8_t CC_Replay_Done(const CC_replay_t *Replay);
+
+#endif /* CC_TRACE */
+
+#endif /* CAN_TRACE_H_ */
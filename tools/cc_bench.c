@@ -0,0 +1,528 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+/*
+ * Host micro-benchmark of the RX and TX poll paths (POSIX).
+ *
+ * Usage: cc_bench [-n FRAMES] [-m MEAN] [-b BURST] [-h HITS] [-k | -x | -l] [-s SEED]
+ *
+ * For table sizes from 8 to 4096 entries, pushes synthetic traffic into an RX
+ * instance and polls it once per system tick, then runs a TX table of the same size
+ * for the same number of ticks. Traffic is Poisson with MEAN frames per tick
+ * (default 8), or bursty with -b: BURST frames at once, MEAN frames per tick on
+ * average. HITS is the fraction of frames matching a table entry (default 0.9).
+ * The RX lookup is the lookup index built by CC_RX_init, or with -k the
+ * CC_RX_Keys_init lookup keys (searched with the CC_RX_SIMD kernel if enabled), or
+ * with -x an open-addressed hash registered as dispatch function. Every RX entry is
+ * supervised with a timeout, and frames that did not fit into the 256-slot receive
+ * buffer are reported as dropped.
+ *
+ * With -l, runs only the RX benchmark with all three lookups on the same traffic,
+ * prints the per-frame dispatch cost (cycles with CC_PROFILE, ns otherwise) of each
+ * table size, and the table sizes from which one lookup stays cheaper than another.
+ * tools/cc_bench.sh runs this sweep for the scalar, SSE2 and AVX2 builds.
+ *
+ * Reports wall-clock ns per frame including the push, and with CC_PROFILE set to 1
+ * the cycles per measured call of every poll stage (TSC cycles on x86, ns
+ * elsewhere). On a Cortex-M target, the same numbers come from CC_DWT_init and
+ * CC_RX_ProfileGet/CC_TX_ProfileGet.
+ *
+ * Build from the repository root, with profiling:
+ *   cc -O2 -DCC_PROFILE=1 -I. tools/cc_bench.c can_core.c -o cc_bench -lm
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "can_core.h"
+#include "can_table_gen.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#if CC_PROFILE && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+#define BENCH_BUF_SIZE 256u
+#define BENCH_MAX_TABLE 4096u
+#define BENCH_MAX_BURST 4096u
+#define BENCH_TIMEOUT 100u
+#define BENCH_SIZES 10u
+#define BENCH_HASH_BITS 13u
+#define BENCH_HASH_SIZE (1u << BENCH_HASH_BITS)
+
+typedef enum
+{
+    BENCH_INDEX,
+    BENCH_KEYS,
+    BENCH_HASH,
+    BENCH_LOOKUPS
+} Bench_lookup_t;
+
+typedef struct
+{
+    double NsPerFrame;
+    double DispatchPerFrame;
+    double Dropped;
+    uint64_t Timeouts;
+} Bench_result_t;
+
+static const char *const Lookup_name[BENCH_LOOKUPS] = {"index", "keys ", "hash "};
+
+static CC_RX_table_t RxTable[BENCH_MAX_TABLE];
+static CC_TX_table_t TxTable[BENCH_MAX_TABLE];
+static uint8_t TxData[BENCH_MAX_TABLE][8];
+static uint32_t Keys[BENCH_MAX_TABLE];
+static uint16_t KeyIdx[BENCH_MAX_TABLE];
+static uint32_t HashKey[BENCH_HASH_SIZE];
+static uint16_t HashPos[BENCH_HASH_SIZE];
+static CC_RX_message_t RxBuf[BENCH_BUF_SIZE];
+static CC_TX_message_t TxBuf[BENCH_BUF_SIZE];
+#if CC_FD_SUPPORT
+static uint8_t RxPayload[BENCH_BUF_SIZE * 8u];
+static uint8_t TxPayload[BENCH_BUF_SIZE * 8u];
+#endif
+
+static CC_TIME_VAL_t Tick;
+static uint64_t Parsed;
+static uint64_t Timeouts;
+static uint64_t Sent;
+
+static uint64_t Monotonic_ns(void)
+{
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (uint64_t)Ts.tv_sec * 1000000000u + (uint64_t)Ts.tv_nsec;
+}
+
+#if CC_PROFILE
+static uint32_t Cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__rdtsc();
+#else
+    return (uint32_t)Monotonic_ns();
+#endif
+}
+#endif
+
+static CC_TIME_VAL_t Tick_get(void)
+{
+    return Tick;
+}
+
+static uint64_t Rng_state = 88172645463325252u;
+
+static uint64_t Rng(void)
+{
+    Rng_state ^= Rng_state << 13;
+    Rng_state ^= Rng_state >> 7;
+    Rng_state ^= Rng_state << 17;
+    return Rng_state;
+}
+
+static double Uniform(void)
+{
+    return (double)(Rng() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static uint32_t Poisson(double Mean)
+{
+    double Limit = exp(-Mean);
+    double Product = Uniform();
+    uint32_t Count = 0;
+
+    while (Product > Limit)
+    {
+        Product *= Uniform();
+        Count++;
+    }
+    return Count;
+}
+
+static void Rx_parser(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg, uint16_t Slot)
+{
+    (void)Instance;
+    (void)Msg;
+    (void)Slot;
+    Parsed++;
+}
+
+static void Rx_unreg(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg)
+{
+    (void)Instance;
+    (void)Msg;
+    Parsed++;
+}
+
+static void Rx_timeout(CC_RX_instance_t *Instance, uint16_t Slot)
+{
+    (void)Instance;
+    (void)Slot;
+    Timeouts++;
+}
+
+static void Tx_send(const CC_TX_instance_t *Instance, const CC_TX_message_t *Msg)
+{
+    (void)Instance;
+    (void)Msg;
+    Sent++;
+}
+
+static CC_BusIsFree_t Tx_bus(const CC_TX_instance_t *Instance)
+{
+    (void)Instance;
+    return CC_BUS_FREE;
+}
+
+static uint32_t Hash_slot(uint32_t Key)
+{
+    return (Key * 2654435761u) >> (32u - BENCH_HASH_BITS);
+}
+
+/* Empty slots hold key 0, which the benchmark IDs never use. */
+static void Hash_build(uint16_t Size)
+{
+    for (uint32_t i = 0; i < BENCH_HASH_SIZE; i++)
+    {
+        HashKey[i] = 0;
+    }
+    for (uint16_t i = 0; i < Size; i++)
+    {
+        uint32_t Key = CC_RX_KEY(RxTable[i].ID, RxTable[i].IDE_flag);
+        uint32_t Slot = Hash_slot(Key);
+
+        while (0 != HashKey[Slot])
+        {
+            Slot = (Slot + 1u) & (BENCH_HASH_SIZE - 1u);
+        }
+        HashKey[Slot] = Key;
+        HashPos[Slot] = i;
+    }
+}
+
+static CC_RX_table_t *Hash_dispatch(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg)
+{
+    uint32_t Key = CC_RX_KEY(Msg->ID, Msg->IDE_flag);
+
+    for (uint32_t Slot = Hash_slot(Key); 0 != HashKey[Slot]; Slot = (Slot + 1u) & (BENCH_HASH_SIZE - 1u))
+    {
+        if (HashKey[Slot] == Key)
+        {
+            CC_RX_table_t *Entry = &Instance->RxTable[HashPos[Slot]];
+
+            if (Entry->DLC != Msg->DLC)
+            {
+                return NULL;
+            }
+            Entry->Parser(Instance, Msg, Entry->SlotNo);
+            return Entry;
+        }
+    }
+    return NULL;
+}
+
+#if CC_PROFILE
+static double Per_call(const CC_profile_t *Profile)
+{
+    return (0 != Profile->Calls) ? (double)Profile->Cycles / Profile->Calls : 0.0;
+}
+#endif
+
+static Bench_result_t Bench_rx(uint16_t Size, uint32_t Frames, double Mean, uint32_t Burst, double Hits,
+                               Bench_lookup_t Lookup, uint8_t Quiet)
+{
+    static uint8_t Data[8];
+    CC_RX_instance_t Rx;
+    Bench_result_t Result;
+
+    for (uint16_t i = 0; i < Size; i++)
+    {
+        RxTable[i] = (CC_RX_table_t){
+            .SlotNo = i, .ID = 0x10u + 2u * i, .DLC = 8, .TimeOut = BENCH_TIMEOUT, .Parser = Rx_parser};
+    }
+    CC_RX_init(&Rx, RxBuf, BENCH_BUF_SIZE, RxTable, Size, Rx_unreg, Rx_timeout);
+    CC_RX_tick_function_register(&Rx, Tick_get);
+#if CC_FD_SUPPORT
+    CC_RX_FD_init(&Rx, RxPayload, 8);
+#endif
+    if (BENCH_KEYS == Lookup)
+    {
+        CC_RX_Keys_init(&Rx, Keys, KeyIdx);
+    }
+    else if (BENCH_HASH == Lookup)
+    {
+        Hash_build(Size);
+        CC_RX_dispatch_function_register(&Rx, Hash_dispatch);
+    }
+
+    /* Traffic is generated up front so the generator stays out of the measurement. */
+    uint32_t *Ids = malloc(sizeof(uint32_t) * Frames);
+    uint32_t Polls = 0;
+    uint32_t *PerPoll = malloc(sizeof(uint32_t) * (Frames + 1u));
+
+    if ((NULL == Ids) || (NULL == PerPoll))
+    {
+        fprintf(stderr, "cc_bench: out of memory\n");
+        exit(1);
+    }
+    for (uint32_t i = 0; i < Frames; i++)
+    {
+        uint32_t Slot = (uint32_t)(Rng() % Size);
+
+        Ids[i] = (Uniform() < Hits) ? (0x10u + 2u * Slot) : (0x11u + 2u * Slot);
+    }
+    for (uint32_t Left = Frames; Left > 0; Polls++)
+    {
+        uint32_t Count;
+
+        if (0 != Burst)
+        {
+            Count = (Uniform() * Burst < Mean) ? Burst : 0u;
+        }
+        else
+        {
+            Count = Poisson(Mean);
+        }
+        PerPoll[Polls] = (Count < Left) ? Count : Left;
+        Left -= PerPoll[Polls];
+    }
+
+    Parsed = 0;
+    Timeouts = 0;
+    Tick = 0;
+
+    uint64_t Start = Monotonic_ns();
+    uint32_t Pos = 0;
+
+    for (uint32_t p = 0; p < Polls; p++)
+    {
+        for (uint32_t i = 0; i < PerPoll[p]; i++, Pos++)
+        {
+            CC_RX_PushMsg(&Rx, Ids[Pos], Data, 8, 0);
+        }
+        Tick++;
+        CC_RX_Poll(&Rx);
+    }
+
+    double Ns = (double)(Monotonic_ns() - Start);
+
+    Result.NsPerFrame = Ns / Frames;
+    Result.DispatchPerFrame = Result.NsPerFrame;
+    Result.Dropped = 100.0 * (double)(Frames - Parsed) / Frames;
+    Result.Timeouts = Timeouts;
+#if CC_PROFILE
+    CC_RX_profile_t Profile;
+
+    CC_RX_ProfileGet(&Rx, &Profile);
+    Result.DispatchPerFrame =
+        (0 != Profile.Dispatch.Items) ? (double)Profile.Dispatch.Cycles / Profile.Dispatch.Items : 0.0;
+#endif
+    if (!Quiet)
+    {
+        printf("RX %5u %s %9.1f ns/frame %7.3f%% dropped %8llu timeouts", (unsigned)Size, Lookup_name[Lookup],
+               Result.NsPerFrame, Result.Dropped, (unsigned long long)Result.Timeouts);
+#if CC_PROFILE
+        printf(" | dispatch %9.0f cyc/poll %7.1f cyc/frame  timeout %7.0f cyc/poll", Per_call(&Profile.Dispatch),
+               Result.DispatchPerFrame, Per_call(&Profile.Timeout));
+#endif
+        printf("\n");
+    }
+
+    free(Ids);
+    free(PerPoll);
+    return Result;
+}
+
+static void Bench_tx(uint16_t Size, uint32_t Ticks)
+{
+    CC_TX_instance_t Tx;
+
+    for (uint16_t i = 0; i < Size; i++)
+    {
+        TxTable[i] = (CC_TX_table_t){.SlotNo = i,
+                                     .ID = 0x10u + i,
+                                     .Data = TxData[i],
+                                     .DLC = 8,
+                                     .SendFreq = (CC_TIME_t)(10u + 10u * (i % 10u)),
+                                     .Offset = (CC_TIME_t)((i / 10u) % (10u + 10u * (i % 10u)))};
+    }
+    Tick = 0;
+    CC_TX_init(&Tx, TxBuf, BENCH_BUF_SIZE, TxTable, Size, Tx_send, Tx_bus);
+    CC_TX_tick_function_register(&Tx, Tick_get);
+#if CC_FD_SUPPORT
+    CC_TX_FD_init(&Tx, TxPayload, 8);
+#endif
+
+    Sent = 0;
+
+    uint64_t Start = Monotonic_ns();
+
+    for (uint32_t t = 0; t < Ticks; t++)
+    {
+        Tick++;
+        CC_TX_Poll(&Tx);
+    }
+
+    double Ns = (double)(Monotonic_ns() - Start);
+
+    printf("TX %5u       %9.1f ns/frame %9.1f ns/poll", (unsigned)Size, (0 != Sent) ? Ns / (double)Sent : 0.0,
+           Ns / Ticks);
+#if CC_PROFILE
+    CC_TX_profile_t Profile;
+
+    CC_TX_ProfileGet(&Tx, &Profile);
+    printf(" | tables %9.0f cyc/poll  send %7.0f cyc/poll", Per_call(&Profile.Tables), Per_call(&Profile.Send));
+#endif
+    printf("\n");
+}
+
+static const char *Keys_kernel(void)
+{
+#if CC_RX_SIMD && defined(__AVX2__)
+    return "AVX2";
+#elif CC_RX_SIMD && defined(__SSE2__)
+    return "SSE2";
+#elif CC_RX_SIMD
+    return "scalar block";
+#else
+    return "binary search";
+#endif
+}
+
+/* Smallest table size from which lookup A stays cheaper than lookup B, 0 if none. */
+static uint32_t Crossover(double (*Cost)[BENCH_LOOKUPS], uint32_t Rows, Bench_lookup_t A, Bench_lookup_t B)
+{
+    uint32_t From = 0;
+
+    for (uint32_t r = Rows; r-- > 0;)
+    {
+        if (Cost[r][A] >= Cost[r][B])
+        {
+            break;
+        }
+        From = 8u << r;
+    }
+    return From;
+}
+
+static void Sweep(uint32_t Frames, double Mean, uint32_t Burst, double Hits)
+{
+    static const Bench_lookup_t Pairs[][2] = {
+        {BENCH_KEYS, BENCH_INDEX}, {BENCH_HASH, BENCH_INDEX}, {BENCH_HASH, BENCH_KEYS}, {BENCH_KEYS, BENCH_HASH}};
+    double Cost[BENCH_SIZES][BENCH_LOOKUPS];
+    uint32_t Rows = 0;
+
+    printf("lookup sweep, keys searched by %s, %s per frame\n", Keys_kernel(),
+           CC_PROFILE ? "dispatch cycles" : "ns from push to parse");
+    printf("sweep  size    index     keys     hash\n");
+    for (uint32_t Size = 8; Size <= BENCH_MAX_TABLE; Size *= 2, Rows++)
+    {
+        uint64_t Seed = Rng_state;
+
+        printf("sweep %5u", (unsigned)Size);
+        for (int l = 0; l < BENCH_LOOKUPS; l++)
+        {
+            /* Every lookup gets the same traffic. */
+            Rng_state = Seed;
+            Cost[Rows][l] = Bench_rx((uint16_t)Size, Frames, Mean, Burst, Hits, (Bench_lookup_t)l, 1).DispatchPerFrame;
+            printf(" %8.1f", Cost[Rows][l]);
+        }
+        printf("\n");
+    }
+    for (uint32_t p = 0; p < sizeof(Pairs) / sizeof(Pairs[0]); p++)
+    {
+        uint32_t From = Crossover(Cost, Rows, Pairs[p][0], Pairs[p][1]);
+
+        printf("crossover %s < %s: ", Lookup_name[Pairs[p][0]], Lookup_name[Pairs[p][1]]);
+        if (0 != From)
+        {
+            printf("from %u entries\n", (unsigned)From);
+        }
+        else
+        {
+            printf("not up to %u entries\n", (unsigned)BENCH_MAX_TABLE);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t Frames = 1000000;
+    double Mean = 8.0;
+    uint32_t Burst = 0;
+    double Hits = 0.9;
+    Bench_lookup_t Lookup = BENCH_INDEX;
+    uint8_t SweepOnly = 0;
+    int Opt;
+
+    while (-1 != (Opt = getopt(argc, argv, "n:m:b:h:kxls:")))
+    {
+        switch (Opt)
+        {
+        case 'n':
+            Frames = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'm':
+            Mean = strtod(optarg, NULL);
+            break;
+        case 'b':
+            Burst = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'h':
+            Hits = strtod(optarg, NULL);
+            break;
+        case 'k':
+            Lookup = BENCH_KEYS;
+            break;
+        case 'x':
+            Lookup = BENCH_HASH;
+            break;
+        case 'l':
+            SweepOnly = 1;
+            break;
+        case 's':
+            Rng_state = strtoull(optarg, NULL, 0) | 1u;
+            break;
+        default:
+            fprintf(stderr, "usage: cc_bench [-n FRAMES] [-m MEAN] [-b BURST] [-h HITS] [-k | -x | -l] [-s SEED]\n");
+            return 2;
+        }
+    }
+    if ((0 == Frames) || !(Mean > 0.0) || (Burst > BENCH_MAX_BURST) || ((0 != Burst) && (Burst < Mean)))
+    {
+        fprintf(stderr, "cc_bench: invalid traffic parameters\n");
+        return 2;
+    }
+
+#if CC_PROFILE
+    CC_cycle_function_register(Cycles);
+#endif
+    printf("%u frames, %s traffic, %.1f frames/tick, %.0f%% hits\n", (unsigned)Frames, Burst ? "bursty" : "Poisson",
+           Mean, 100.0 * Hits);
+
+    if (SweepOnly)
+    {
+        Sweep(Frames, Mean, Burst, Hits);
+        return 0;
+    }
+    for (uint32_t Size = 8; Size <= BENCH_MAX_TABLE; Size *= 2)
+    {
+        Bench_rx((uint16_t)Size, Frames, Mean, Burst, Hits, Lookup, 0);
+    }
+    for (uint32_t Size = 8; Size <= BENCH_MAX_TABLE; Size *= 2)
+    {
+        Bench_tx((uint16_t)Size, (uint32_t)(Frames / Mean) + 1u);
+    }
+    return 0;
+}
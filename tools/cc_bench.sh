@@ -0,0 +1,86 @@
+#!/bin/sh
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# Author: Adrian Pietrzak
+# GitHub: https://github.com/AdrianPietrzak1998
+# Created: Oct 14, 2026
+
+# RX lookup crossover benchmark (x86 hosts).
+#
+# Usage: tools/cc_bench.sh [cc_bench options]
+#
+# Builds cc_bench with CC_PROFILE in three variants of the CC_RX_Keys_init lookup:
+# plain binary search (CC_RX_SIMD=0), SSE2 block search and AVX2 block search
+# (CC_RX_SIMD=1). Runs the -l lookup sweep of each on the same traffic, then prints
+# the dispatch cycles per frame of every lookup and table size side by side, and
+# the table sizes from which one lookup stays cheaper than another. The AVX2
+# variant is skipped if the host CPU lacks AVX2. Options are passed to cc_bench,
+# e.g. -n 200000 -h 1.0. CC and CFLAGS select the compiler and extra flags.
+
+set -e
+
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+CC=${CC:-cc}
+
+build()
+{
+    "$CC" -O2 $CFLAGS -DCC_PROFILE=1 "$@" -I"$ROOT" "$ROOT/tools/cc_bench.c" "$ROOT/can_core.c" -o "$OUT/cc_bench" -lm
+}
+
+run()
+{
+    "$OUT/cc_bench" -l "$@" | tee /dev/stderr | awk '$1 == "sweep" && $2 ~ /^[0-9]+$/ { print $2, $3, $4, $5 }'
+}
+
+build -DCC_RX_SIMD=0
+run "$@" > "$OUT/scalar"
+build -DCC_RX_SIMD=1 -msse2 -mno-avx2
+run "$@" > "$OUT/sse2"
+if grep -q avx2 /proc/cpuinfo 2>/dev/null; then
+    build -DCC_RX_SIMD=1 -mavx2
+    run "$@" > "$OUT/avx2"
+else
+    awk '{ print $1, "-", "-", "-" }' "$OUT/scalar" > "$OUT/avx2"
+fi
+
+# Columns: size, index, keys (binary search), keys (SSE2), keys (AVX2), hash.
+paste -d ' ' "$OUT/scalar" "$OUT/sse2" "$OUT/avx2" | awk '
+function cross(a, b,    r, from) {
+    from = 0
+    for (r = n; r >= 1; r--) {
+        if (cost[r, a] == "-" || cost[r, b] == "-" || cost[r, a] + 0 >= cost[r, b] + 0)
+            break
+        from = size[r]
+    }
+    return from ? "from " from " entries" : "not up to " size[n] " entries"
+}
+{
+    n++
+    size[n] = $1
+    cost[n, 1] = $2; cost[n, 2] = $3; cost[n, 3] = $7; cost[n, 4] = $11; cost[n, 5] = $4
+}
+END {
+    name[1] = "index"; name[2] = "keys"; name[3] = "keys+SSE2"; name[4] = "keys+AVX2"; name[5] = "hash"
+    printf "\ndispatch cycles per frame\n%5s", "size"
+    for (c = 1; c <= 5; c++)
+        printf " %10s", name[c]
+    printf "\n"
+    for (r = 1; r <= n; r++) {
+        printf "%5s", size[r]
+        for (c = 1; c <= 5; c++)
+            printf " %10s", cost[r, c]
+        printf "\n"
+    }
+    printf "\n"
+    printf "keys+SSE2 < keys:      %s\n", cross(3, 2)
+    printf "keys+AVX2 < keys+SSE2: %s\n", cross(4, 3)
+    printf "keys+SSE2 < hash:      %s\n", cross(3, 5)
+    printf "keys+AVX2 < hash:      %s\n", cross(4, 5)
+    printf "hash < keys+SSE2:      %s\n", cross(5, 3)
+}'
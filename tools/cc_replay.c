@@ -0,0 +1,196 @@
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ * Author: Adrian Pietrzak
+ * GitHub: https://github.com/AdrianPietrzak1998
+ * Created: Oct 14, 2026
+ */
+
+/*
+ * Host replay driver of capture files (POSIX).
+ *
+ * Usage: cc_replay [-r] [-u UNITS] [-c CHANNEL] capture.cctr
+ *
+ * Memory-maps a capture file (a CC_trace_file_t header followed by the records
+ * drained from a trace ring) and feeds it through CC_RX_PushMsg into an RX instance
+ * without a table, counting the frames reaching Parser_unreg_msg. By default the
+ * records are replayed as fast as possible; with -r at their original timing, with
+ * UNITS record time units per millisecond (default 1). Prints the throughput.
+ *
+ * Build from the repository root, with CC_TRACE set to 1 in can_core.h and the same
+ * CC_FD_SUPPORT setting as the capturing target:
+ *   cc -O2 -I. tools/cc_replay.c can_core.c can_trace.c -o cc_replay
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "can_core.h"
+#include "can_trace.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#if !CC_TRACE
+#error "cc_replay needs CC_TRACE set to 1 in can_core.h"
+#endif
+
+#define REPLAY_BUF_SIZE 1024u
+
+static CC_RX_message_t RxBuf[REPLAY_BUF_SIZE];
+#if CC_FD_SUPPORT
+static uint8_t RxPayload[REPLAY_BUF_SIZE * CC_MAX_DATA_LEN];
+#endif
+
+static uint64_t Frames;
+static uint64_t Bytes;
+
+static uint64_t Monotonic_ns(void)
+{
+    struct timespec Ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &Ts);
+    return (uint64_t)Ts.tv_sec * 1000000000u + (uint64_t)Ts.tv_nsec;
+}
+
+static CC_TIME_VAL_t Tick_ms(void)
+{
+    return (CC_TIME_VAL_t)(Monotonic_ns() / 1000000u);
+}
+
+static void Count_msg(const CC_RX_instance_t *Instance, CC_RX_message_t *Msg)
+{
+    (void)Instance;
+#if CC_FD_SUPPORT
+    Bytes += CC_DlcToLen(Msg->DLC, Msg->FDF_flag);
+#else
+    Bytes += CC_DlcToLen(Msg->DLC, 0);
+#endif
+    Frames++;
+}
+
+static void Usage(void)
+{
+    fprintf(stderr, "usage: cc_replay [-r] [-u UNITS] [-c CHANNEL] capture.cctr\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    uint8_t Realtime = 0;
+    uint32_t Units = 1;
+    uint8_t Channel = CC_REPLAY_ALL_CHANNELS;
+    int Opt;
+
+    while (-1 != (Opt = getopt(argc, argv, "ru:c:")))
+    {
+        switch (Opt)
+        {
+        case 'r':
+            Realtime = 1;
+            break;
+        case 'u':
+            Units = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'c':
+            Channel = (uint8_t)strtoul(optarg, NULL, 0);
+            break;
+        default:
+            Usage();
+        }
+    }
+    if ((optind + 1 != argc) || (0 == Units))
+    {
+        Usage();
+    }
+
+    int Fd = open(argv[optind], O_RDONLY);
+    struct stat St;
+
+    if ((Fd < 0) || (0 != fstat(Fd, &St)))
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+    if ((size_t)St.st_size < sizeof(CC_trace_file_t))
+    {
+        fprintf(stderr, "%s: not a capture file\n", argv[optind]);
+        return 1;
+    }
+
+    const uint8_t *Map = mmap(NULL, (size_t)St.st_size, PROT_READ, MAP_PRIVATE, Fd, 0);
+
+    if (MAP_FAILED == Map)
+    {
+        perror("mmap");
+        return 1;
+    }
+    close(Fd);
+
+    const CC_trace_file_t *Header = (const CC_trace_file_t *)(const void *)Map;
+
+    if (!CC_Trace_FileCheck(Header))
+    {
+        fprintf(stderr, "%s: capture format does not match this build (record size %u, flags 0x%x)\n", argv[optind],
+                (unsigned)Header->RecordSize, (unsigned)Header->Flags);
+        return 1;
+    }
+
+    uint32_t Count = (uint32_t)(((size_t)St.st_size - sizeof(CC_trace_file_t)) / sizeof(CC_trace_record_t));
+    const CC_trace_record_t *Records = (const CC_trace_record_t *)(const void *)(Map + sizeof(CC_trace_file_t));
+
+    madvise((void *)(uintptr_t)Map, (size_t)St.st_size, MADV_SEQUENTIAL);
+
+    CC_RX_instance_t Rx;
+    CC_replay_t Replay;
+
+    CC_RX_init(&Rx, RxBuf, REPLAY_BUF_SIZE, NULL, 0, Count_msg, NULL);
+    CC_RX_tick_function_register(&Rx, Tick_ms);
+#if CC_FD_SUPPORT
+    CC_RX_FD_init(&Rx, RxPayload, CC_MAX_DATA_LEN);
+#endif
+    CC_Replay_init(&Replay, Records, Count, Channel);
+    if (Realtime)
+    {
+        CC_Replay_Realtime_init(&Replay, Units);
+    }
+
+    uint64_t Start = Monotonic_ns();
+
+    while (!CC_Replay_Done(&Replay))
+    {
+        CC_Replay_Step(&Replay, &Rx, Tick_ms());
+        CC_RX_Poll(&Rx);
+
+        if (Realtime)
+        {
+            CC_TIME_VAL_t Wait = CC_Replay_NextEvent(&Replay, Tick_ms());
+
+            if ((0 != Wait) && ((CC_TIME_VAL_t)CC_MAX_TIMEOUT != Wait))
+            {
+                struct timespec Ts = {.tv_sec = (time_t)(Wait / 1000u), .tv_nsec = (long)(Wait % 1000u) * 1000000L};
+
+                nanosleep(&Ts, NULL);
+            }
+        }
+    }
+    CC_RX_Poll(&Rx);
+
+    double Seconds = (double)(Monotonic_ns() - Start) / 1e9;
+
+    printf("%llu of %lu records replayed, %llu frames / %llu bytes parsed in %.3f s", (unsigned long long)Replay.Pushed,
+           (unsigned long)Count, (unsigned long long)Frames, (unsigned long long)Bytes, Seconds);
+    if (Seconds > 0.0)
+    {
+        printf(" (%.0f frames/s)", (double)Frames / Seconds);
+    }
+    printf("\n");
+
+    munmap((void *)(uintptr_t)Map, (size_t)St.st_size);
+    return 0;
+}
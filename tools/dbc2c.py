@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+# Author: Adrian Pietrzak
+# GitHub: https://github.com/AdrianPietrzak1998
+# Created: Oct 14, 2026
+
+"""Generates can_signal.h descriptor tables from a DBC file.
+
+Usage: dbc2c.py input.dbc output_base [--prefix PREFIX]
+
+Writes output_base.h and output_base.c. For every message (BO_) the header
+declares the ID, payload length, DLC code, the signal enumerators and the
+descriptor array; the source file defines the arrays. The header also provides
+PREFIX_MESSAGES(X), an X-macro list with one X(Name, ID, IDE_flag, FDF_flag, DLC,
+CycleTime) line per message, which can be adapted to the can_table_gen.h RX/TX lists.
+
+Multiplexor indicators (M / mN) are not interpreted: multiplexed signals are
+emitted like plain ones and flagged in a comment.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+BO_RE = re.compile(r'^BO_\s+(\d+)\s+(\w+)\s*:\s*(\d+)\s+(\w+)')
+SG_RE = re.compile(r'^SG_\s+(\w+)\s*(M|m\d+M?)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*'
+                   r'\(\s*([-+0-9.eE]+)\s*,\s*([-+0-9.eE]+)\s*\)')
+CYCLE_RE = re.compile(r'^BA_\s+"GenMsgCycleTime"\s+BO_\s+(\d+)\s+(\d+)\s*;')
+
+FD_LENGTHS = [0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64]
+
+
+class Message:
+    def __init__(self, raw_id, name, length):
+        self.ext = bool(raw_id & 0x80000000)
+        self.id = raw_id & 0x1FFFFFFF
+        self.name = name
+        self.length = length
+        self.cycle = 0
+        self.signals = []
+
+
+def parse(path):
+    messages = []
+    by_id = {}
+    current = None
+
+    with open(path, encoding='latin-1') as dbc:
+        for line in dbc:
+            line = line.strip()
+            match = BO_RE.match(line)
+            if match:
+                current = Message(int(match.group(1)), match.group(2), int(match.group(3)))
+                if current.name == 'VECTOR__INDEPENDENT_SIG_MSG':
+                    current = None
+                    continue
+                messages.append(current)
+                by_id[int(match.group(1))] = current
+                continue
+            match = SG_RE.match(line)
+            if match and current is not None:
+                current.signals.append({
+                    'name': match.group(1),
+                    'mux': match.group(2),
+                    'start': int(match.group(3)),
+                    'length': int(match.group(4)),
+                    'intel': match.group(5) == '1',
+                    'signed': match.group(6) == '-',
+                    'scale': match.group(7),
+                    'offset': match.group(8),
+                })
+                continue
+            if not line.startswith('SG_'):
+                current = None
+            match = CYCLE_RE.match(line)
+            if match and int(match.group(1)) in by_id:
+                by_id[int(match.group(1))].cycle = int(match.group(2))
+    return messages
+
+
+def dlc_code(length):
+    for code, fd_len in enumerate(FD_LENGTHS):
+        if fd_len >= length:
+            return code
+    raise ValueError('payload length %d above 64' % length)
+
+
+def literal(number):
+    value = float(number)
+    return repr(int(value)) if value.is_integer() else repr(value)
+
+
+def check(msg):
+    for sig in msg.signals:
+        if not 1 <= sig['length'] <= 64:
+            raise ValueError('%s.%s: length %d' % (msg.name, sig['name'], sig['length']))
+        if sig['intel']:
+            last = sig['start'] + sig['length'] - 1
+        else:
+            last = (sig['start'] // 8) * 8 + (7 - sig['start'] % 8) + sig['length'] - 1
+        if last // 8 >= msg.length:
+            raise ValueError('%s.%s: outside of the %d byte payload' % (msg.name, sig['name'], msg.length))
+    if len(msg.signals) > 64:
+        raise ValueError('%s: more than 64 signals' % msg.name)
+
+
+def generate(messages, base, prefix, source):
+    guard = re.sub(r'\W', '_', os.path.basename(base)).upper() + '_H_'
+    header = ['/* Generated by dbc2c.py from %s. Do not edit. */' % os.path.basename(source), '',
+              '#ifndef ' + guard, '#define ' + guard, '', '#include "can_signal.h"', '']
+    body = ['/* Generated by dbc2c.py from %s. Do not edit. */' % os.path.basename(source), '',
+            '#include "%s.h"' % os.path.basename(base), '']
+
+    for msg in messages:
+        check(msg)
+        upper = '%s_%s' % (prefix, msg.name.upper())
+        fdf = 1 if msg.length > 8 else 0
+        header += ['/* %s */' % msg.name,
+                   '#define %s_ID 0x%Xu' % (upper, msg.id),
+                   '#define %s_IDE %d' % (upper, msg.ext),
+                   '#define %s_FDF %d' % (upper, fdf),
+                   '#define %s_LEN %du' % (upper, msg.length),
+                   '#define %s_DLC %du' % (upper, dlc_code(msg.length)),
+                   '']
+        if msg.signals:
+            header += ['enum', '{']
+            header += ['    %s_%s,' % (upper, sig['name'].upper()) for sig in msg.signals]
+            header += ['    %s_SIGNAL_COUNT' % upper, '};', '']
+            header += ['extern const CC_signal_t %s_%s_Signals[%s_SIGNAL_COUNT];' % (prefix, msg.name, upper), '']
+
+            body += ['const CC_signal_t %s_%s_Signals[%s_SIGNAL_COUNT] = {' % (prefix, msg.name, upper)]
+            for sig in msg.signals:
+                note = ''
+                if sig['mux'] == 'M':
+                    note = ' /* multiplexor */'
+                elif sig['mux']:
+                    note = ' /* multiplexed (%s) */' % sig['mux']
+                body.append('    [%s_%s] = {.StartBit = %d, .Length = %d, .Order = %s, .Signed = %d, '
+                            '.Scale = %s, .Offset = %s},%s'
+                            % (upper, sig['name'].upper(), sig['start'], sig['length'],
+                               'CC_SIG_INTEL' if sig['intel'] else 'CC_SIG_MOTOROLA', sig['signed'],
+                               literal(sig['scale']), literal(sig['offset']), note))
+            body += ['};', '']
+
+    rows = ['    X(%s, 0x%Xu, %d, %d, %du, %d)'
+            % (msg.name, msg.id, msg.ext, 1 if msg.length > 8 else 0, dlc_code(msg.length), msg.cycle)
+            for msg in messages]
+    header.append('#define %s_MESSAGES(X)%s' % (prefix, ' \\' if rows else ''))
+    header += [row + ' \\' for row in rows[:-1]] + rows[-1:]
+    header += ['', '#endif /* %s */' % guard, '']
+
+    with open(base + '.h', 'w') as out:
+        out.write('\n'.join(header))
+    with open(base + '.c', 'w') as out:
+        out.write('\n'.join(body))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate can_signal.h descriptors from a DBC file.')
+    parser.add_argument('dbc')
+    parser.add_argument('base', help='output path without extension')
+    parser.add_argument('--prefix', default='DBC', help='prefix of the generated names (default DBC)')
+    args = parser.parse_args()
+
+    try:
+        generate(parse(args.dbc), args.base, args.prefix, args.dbc)
+    except (OSError, ValueError) as error:
+        sys.exit('dbc2c: %s' % error)
+
+
+if __name__ == '__main__':
+    main()